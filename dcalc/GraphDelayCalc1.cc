@@ -573,10 +573,8 @@ GraphDelayCalc1::seedDrvrSlew(Vertex *drvr_vertex,
   debugPrint(debug_, "delay_calc", 2, "seed driver slew %s",
              drvr_vertex->name(sdc_network_));
   InputDrive *drive = 0;
-  if (network_->isTopLevelPort(drvr_pin)) {
-    Port *port = network_->port(drvr_pin);
-    drive = sdc_->findInputDrive(port);
-  }
+  if (network_->isTopLevelPort(drvr_pin))
+    drive = sdc_->findInputDrive(drvr_pin);
   for (auto tr : RiseFall::range()) {
     for (auto dcalc_ap : corners_->dcalcAnalysisPts()) {
       if (drive) {
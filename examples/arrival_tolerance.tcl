@@ -0,0 +1,23 @@
+# set_arrival_incremental_tolerance skips propagating small arrival changes
+read_liberty example1_slow.lib
+read_verilog example1.v
+link_design top
+read_sdf example1.sdf
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+report_worst_slack -max -digits 3
+
+# A 1ps change at u1/Z is below the 10ps tolerance so the fanout
+# keeps the previous arrivals.
+sta::set_arrival_incremental_tolerance 10e-12
+sta::clear_search_visit_counts
+set_assigned_delay -cell -fall -from u1/A -to u1/Z 1.101
+report_worst_slack -max -digits 3
+puts "arrival visits [sta::arrival_visit_count]"
+
+# With no tolerance the change propagates to u2/A2, u2/ZN and r3/D.
+sta::set_arrival_incremental_tolerance 0.0
+sta::clear_search_visit_counts
+set_assigned_delay -cell -fall -from u1/A -to u1/Z 1.102
+report_worst_slack -max -digits 3
+puts "arrival visits [sta::arrival_visit_count]"
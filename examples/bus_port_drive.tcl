@@ -0,0 +1,25 @@
+# set_input_transition/set_drive on a bus port apply to the port bits
+read_liberty example1_slow.lib
+read_verilog write_sdc_bus.v
+link_design top
+create_clock -name clk -period 10 [get_ports clk]
+set_input_transition 0.5 [get_ports in]
+set_drive 2 [get_ports in]
+
+close [file tempfile sdc_file bus_port_drive.sdc]
+write_sdc -no_timestamp $sdc_file
+set stream [open $sdc_file r]
+set transitions 0
+set drives 0
+while { [gets $stream line] >= 0 } {
+  if { [string match "set_input_transition *" $line] } {
+    incr transitions
+  }
+  if { [string match "set_drive *" $line] } {
+    incr drives
+  }
+}
+close $stream
+file delete $sdc_file
+puts "input transitions $transitions"
+puts "drives $drives"
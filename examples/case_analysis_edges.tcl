@@ -0,0 +1,18 @@
+# set_case_analysis rising/falling values stop at the cell they enter
+read_liberty example1_slow.lib
+read_verilog example1.v
+link_design top
+
+proc report_sim_values { pins } {
+  foreach pin $pins {
+    puts "$pin [sta::pin_sim_logic_value [get_pins $pin]]"
+  }
+}
+
+set_case_analysis rising u1/A
+set_case_analysis falling r1/D
+report_sim_values {u1/A u1/Z r1/D r1/Q u2/ZN}
+
+# Constants still propagate through the cells.
+set_case_analysis 0 u2/A1
+report_sim_values {u2/ZN r3/D}
@@ -0,0 +1,20 @@
+# arrivals/requireds reported with COMPACT_ARRIVALS=1 match full precision
+# Only a build configured with -DCOMPACT_ARRIVALS=1 stores compact
+# arrivals (see jenkins/test_compact_arrivals.sh).
+read_liberty example1_slow.lib
+read_verilog example1.v
+link_design top
+read_sdf example1.sdf
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+create_clock -name vclk -period 10
+set_input_delay -clock clk 0 {in1 in2}
+set_input_delay -clock vclk 1.25 -add_delay {in1 in2}
+report_worst_slack -max -digits 3
+puts [format "%.3f" [get_property [get_pins r1/D] max_rise_slack]]
+puts [format "%.3f" [get_property [get_pins r1/D] max_fall_slack]]
+puts [format "%.3f" [get_property [get_pins r2/D] max_rise_slack]]
+# Arrivals at in1 and r1/D span more than a compact array holds.
+set_input_delay -clock vclk 8.0 -add_delay {in1}
+puts [format "%.3f" [get_property [get_pins r1/D] max_rise_slack]]
+puts [format "%.3f" [get_property [get_pins r1/D] max_fall_slack]]
+puts [format "%.3f" [get_property [get_pins r2/D] max_rise_slack]]
@@ -0,0 +1,34 @@
+# crpr found with the clock path tree index matches walking the clock paths
+read_liberty example1_slow.lib
+read_verilog crpr_clk_tree.v
+link_design top
+create_clock -name clk -period 10 clk
+set_input_delay -clock clk 0 in1
+set_output_delay -clock clk 0 out
+set_operating_conditions -analysis_type on_chip_variation
+set_timing_derate -early 0.9
+set_timing_derate -late 1.1
+
+# r1 -> r2 share the b1 subtree, r2 -> r3 only share the clock
+# root, and r3 -> r4 reconverge through the mux.
+proc crpr_reports {} {
+  set reports {}
+  foreach to {r2/D r3/D r4/D} {
+    foreach path_delay {min max} {
+      with_output_to_variable report \
+	[list report_checks -to $to -path_delay $path_delay \
+	   -format full_clock_expanded -digits 3]
+      lappend reports $report
+    }
+  }
+  return $reports
+}
+
+set indexed [crpr_reports]
+puts "indexed paths [expr { [sta::crpr_clk_tree_path_count] > 0 }]"
+puts "crpr reported [string match "*clock reconvergence pessimism*" $indexed]"
+
+sta::set_crpr_clk_tree_indexed 0
+set walked [crpr_reports]
+puts "indexed paths [sta::crpr_clk_tree_path_count]"
+puts "matches walked [expr { $indexed == $walked }]"
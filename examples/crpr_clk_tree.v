@@ -0,0 +1,18 @@
+module top (in1, sel, clk, out);
+  input in1, sel, clk;
+  output out;
+  wire ck1, ck2, ck3, ck4, ck5, ckm, r1q, r2q, r3q;
+
+  // Buffered clock subtree.
+  BUF_X1 b1 (.A(clk), .Z(ck1));
+  BUF_X1 b2 (.A(ck1), .Z(ck2));
+  BUF_X1 b3 (.A(ck1), .Z(ck3));
+  DFF_X1 r1 (.D(in1), .CK(ck2), .Q(r1q));
+  DFF_X1 r2 (.D(r1q), .CK(ck3), .Q(r2q));
+  // Clock paths through b5 and around it reconverge at the mux.
+  BUF_X1 b4 (.A(clk), .Z(ck4));
+  BUF_X1 b5 (.A(ck4), .Z(ck5));
+  MUX2_X1 m1 (.A(ck4), .B(ck5), .S(sel), .Z(ckm));
+  DFF_X1 r3 (.D(r2q), .CK(ckm), .Q(r3q));
+  DFF_X1 r4 (.D(r3q), .CK(ck5), .Q(out));
+endmodule // top
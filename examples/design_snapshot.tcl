@@ -0,0 +1,45 @@
+# write_design_snapshot/read_design_snapshot netlist round trip
+read_liberty example1_slow.lib
+read_verilog example1.v
+link_design top
+
+proc netlist {} {
+  set lines {}
+  foreach inst [sort_by_full_name [get_cells *]] {
+    set line "[get_full_name $inst] [get_property $inst ref_name]"
+    foreach pin [sort_by_full_name [get_pins -of_objects $inst]] {
+      set net [$pin net]
+      if { $net != "NULL" } {
+        append line " [$pin port_name]=[get_full_name $net]"
+      }
+    }
+    lappend lines $line
+  }
+  foreach port [sort_by_full_name [get_ports *]] {
+    lappend lines "port [get_full_name $port] [get_property $port direction]"
+  }
+  return [join $lines "\n"]
+}
+
+set netlist1 [netlist]
+close [file tempfile snapshot_file design_snapshot.snap]
+write_design_snapshot $snapshot_file
+read_design_snapshot $snapshot_file
+file delete $snapshot_file
+set netlist2 [netlist]
+puts $netlist2
+puts "round trip [expr { $netlist1 == $netlist2 ? "matches" : "differs" }]"
+
+# A bad snapshot file leaves the current design in place.
+set bad_file [file tempfile bad_path design_snapshot_bad.snap]
+puts $bad_file "not a snapshot"
+close $bad_file
+puts "bad snapshot error [catch { read_design_snapshot $bad_path }]"
+file delete $bad_path
+puts "design kept [expr { [netlist] == $netlist1 ? "matches" : "differs" }]"
+
+# The snapshot network times the same as the linked verilog.
+read_sdf example1.sdf
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+report_worst_slack -max -digits 3
@@ -0,0 +1,36 @@
+# timing queries between begin_eco and commit_eco commit the edits
+read_liberty example1_slow.lib
+read_verilog example1.v
+link_design top
+read_sdf example1.sdf
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+report_worst_slack -max -digits 3
+begin_eco
+disconnect_pin u2z r3/D
+report_worst_slack -max -digits 3
+# Nothing left to commit.
+commit_eco
+report_worst_slack -max -digits 3
+
+# Connects are recorded too, and a timing query commits the open edits.
+begin_eco
+connect_pin u2z r3/D
+report_worst_slack -max -digits 3
+commit_eco
+
+# Equivalent cell replacement keeps the annotated delays.
+begin_eco
+replace_cell u1 BUF_X2
+report_worst_slack -max -digits 3
+commit_eco
+
+# Replacing a cell with different timing arcs deletes and remakes the
+# instance edges inside the eco.
+begin_eco
+replace_cell u2 OR2_X1
+set eco_slack [format "%.3f" [worst_slack -max]]
+commit_eco
+sta::delays_invalid
+set full_slack [format "%.3f" [worst_slack -max]]
+puts "matches full update [expr { $eco_slack == $full_slack }]"
@@ -0,0 +1,17 @@
+# worst slack path through each of a list of pins
+read_liberty example1_slow.lib
+read_verilog example1.v
+link_design top
+read_sdf example1.sdf
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+set pins [get_pins {r1/D r2/D u1/Z r1/Q u2/ZN r3/D}]
+lappend pins [get_ports out]
+foreach pin_path [find_worst_slack_paths -max $pins] {
+  lassign $pin_path pin slack path
+  if { $path == "NULL" } {
+    puts "[get_full_name $pin] $slack"
+  } else {
+    puts "[get_full_name $pin] [format %.3f $slack]"
+  }
+}
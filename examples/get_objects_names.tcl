@@ -0,0 +1,18 @@
+# get_pins/get_cells resolve plain names in one pass and match the rest
+read_liberty example1_slow.lib
+read_verilog example1.v
+link_design top
+
+proc full_names { objects } {
+  set names {}
+  foreach object $objects {
+    lappend names [get_full_name $object]
+  }
+  return $names
+}
+
+# Plain names, a wildcard and a missing name.
+puts [full_names [get_pins -quiet {r1/D u1/Z u2/A* r9/D r3/Q}]]
+puts [full_names [get_cells -quiet {r2 u* r9 r1}]]
+# Regular expressions are matched one at a time.
+puts [full_names [get_pins -regexp {r1/D u1/.}]]
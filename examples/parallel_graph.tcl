@@ -0,0 +1,30 @@
+# graph built with thread_count > 1 has the same vertex and edge ids as serial
+read_liberty example1_slow.lib
+read_verilog example1.v
+
+# Drive u1z from r1/Q as well as u1/Z so a net has more than one driver.
+proc graph_dump { thread_count } {
+  sta::set_thread_count $thread_count
+  link_design top
+  disconnect_pin r1q r1/Q
+  connect_pin u1z r1/Q
+  set dump {}
+  set vertex_iter [sta::vertex_iterator]
+  while {[$vertex_iter has_next]} {
+    set vertex [$vertex_iter next]
+    lappend dump "[$vertex id] [get_full_name [$vertex pin]] [$vertex is_bidirect_driver]"
+    set edge_iter [$vertex out_edge_iterator]
+    while {[$edge_iter has_next]} {
+      set edge [$edge_iter next]
+      lappend dump " [$edge id] [get_full_name [$edge to_pin]] [$edge sense]"
+    }
+    $edge_iter finish
+  }
+  $vertex_iter finish
+  return [list [sta::graph_edge_count] $dump]
+}
+
+set serial [graph_dump 1]
+set parallel [graph_dump 4]
+puts "edge count matches [expr {[lindex $serial 0] == [lindex $parallel 0]}]"
+puts "matches serial [expr {$serial == $parallel}]"
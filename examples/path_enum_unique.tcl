@@ -0,0 +1,28 @@
+# unique path enumeration has the same results with one or more threads
+read_liberty example1_slow.lib
+read_verilog example1.v
+link_design top
+read_sdf example1.sdf
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+
+proc path_ends_string { args } {
+  set result ""
+  foreach end [eval find_timing_paths $args] {
+    set pin [[$end vertex] pin]
+    append result "[get_full_name $pin] [format %.3f [$end slack]]\n"
+  }
+  return $result
+}
+
+foreach endpoint_count {1 3} {
+  set args [list -group_count 5 -endpoint_count $endpoint_count \
+	      -unique_paths_to_endpoint]
+  sta::set_thread_count 1
+  set serial [eval path_ends_string $args]
+  sta::set_thread_count 4
+  set parallel [eval path_ends_string $args]
+  puts "endpoint_count $endpoint_count"
+  puts -nonewline $serial
+  puts "parallel [expr { $serial == $parallel ? "matches" : "differs" }]"
+}
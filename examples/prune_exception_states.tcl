@@ -0,0 +1,20 @@
+# sta_prune_exception_states merges tags once an exception cannot apply
+read_liberty example1_slow.lib
+read_verilog example1.v
+link_design top
+read_sdf example1.sdf
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+# Paths from r1 never reach u1/Z, so the exception state started at
+# r1/CK is dead past the u1/Z level.
+set_multicycle_path 2 -setup -from [get_pins r1/CK] -through [get_pins u1/Z]
+
+report_worst_slack -max -digits 3
+set tags [sta::tag_count]
+set tag_groups [sta::tag_group_count]
+
+set sta_prune_exception_states 1
+report_worst_slack -max -digits 3
+puts "pruned states [expr { [sta::pruned_exception_state_count] > 0 }]"
+puts "fewer tags [expr { [sta::tag_count] < $tags }]"
+puts "fewer tag groups [expr { [sta::tag_group_count] < $tag_groups }]"
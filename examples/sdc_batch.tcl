@@ -0,0 +1,9 @@
+# read_sdc with constraint edits followed by reports in the sdc file
+read_liberty example1_slow.lib
+read_verilog example1.v
+link_design top
+read_sdf example1.sdf
+read_sdc sdc_batch.sdc
+report_worst_slack -max
+set_input_delay -clock clk 9.2 {in2}
+report_worst_slack -max
@@ -0,0 +1,35 @@
+# write_sdc -collapse_buses round trip with a full bus and a partial bus
+read_liberty example1_slow.lib
+read_verilog write_sdc_bus.v
+link_design top
+create_clock -name clk -period 10 [get_ports clk]
+set_false_path -from [get_ports {in[0] in[1] in[2] in[3]}] \
+  -to [get_ports {out[0] out[2]}]
+
+proc read_file { filename } {
+  set stream [open $filename r]
+  set text [read $stream]
+  close $stream
+  return $text
+}
+
+# Format the sections on multiple threads.
+sta::set_thread_count 4
+close [file tempfile sdc_file1 write_sdc_bus1.sdc]
+write_sdc -collapse_buses -no_timestamp $sdc_file1
+set sdc1 [read_file $sdc_file1]
+puts -nonewline $sdc1
+
+# Read the collapsed buses back into a clean design and write them again.
+link_design top
+read_sdc $sdc_file1
+close [file tempfile sdc_file2 write_sdc_bus2.sdc]
+write_sdc -collapse_buses -no_timestamp $sdc_file2
+set sdc2 [read_file $sdc_file2]
+puts "round trip [expr { $sdc1 == $sdc2 ? "matches" : "differs" }]"
+
+# The single threaded writer makes the same file.
+sta::set_thread_count 1
+write_sdc -collapse_buses -no_timestamp $sdc_file2
+puts "single thread [expr { [read_file $sdc_file2] == $sdc1 ? "matches" : "differs" }]"
+file delete $sdc_file1 $sdc_file2
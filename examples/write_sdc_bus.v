@@ -0,0 +1,10 @@
+module top (in, clk, out);
+  input [3:0] in;
+  input clk;
+  output [3:0] out;
+
+  DFF_X1 r0 (.D(in[0]), .CK(clk), .Q(out[0]));
+  DFF_X1 r1 (.D(in[1]), .CK(clk), .Q(out[1]));
+  DFF_X1 r2 (.D(in[2]), .CK(clk), .Q(out[2]));
+  DFF_X1 r3 (.D(in[3]), .CK(clk), .Q(out[3]));
+endmodule
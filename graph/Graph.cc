@@ -16,8 +16,15 @@
 
 #include "Graph.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
 #include "Debug.hh"
 #include "Stats.hh"
+#include "DispatchQueue.hh"
 #include "MinMax.hh"
 #include "Mutex.hh"
 #include "Transition.hh"
@@ -87,14 +94,208 @@ Graph::makeVerticesAndEdges()
   makeSlewTables(ap_count_);
   makeArcDelayTables(ap_count_);
 
-  LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
-  while (leaf_iter->hasNext()) {
-    const Instance *inst = leaf_iter->next();
-    makePinVertices(inst);
-    makeInstanceEdges(inst);
+  if (thread_count_ > 1)
+    makeVerticesAndEdgesParallel();
+  else {
+    LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
+    while (leaf_iter->hasNext()) {
+      const Instance *inst = leaf_iter->next();
+      makePinVertices(inst);
+      makeInstanceEdges(inst);
+    }
+    delete leaf_iter;
+    makePinVertices(network_->topInstance());
   }
+}
+
+// Edge found by a parallel graph construction pass that is made
+// (allocated and linked) later.
+class PendingEdge
+{
+public:
+  PendingEdge(Vertex *from,
+	      Vertex *to,
+	      TimingArcSet *arc_set,
+	      bool is_check,
+	      bool is_bidirect_inst_path);
+
+  Vertex *from_;
+  Vertex *to_;
+  TimingArcSet *arc_set_;
+  Edge *edge_;
+  bool is_check_;
+  bool is_bidirect_inst_path_;
+};
+
+PendingEdge::PendingEdge(Vertex *from,
+			 Vertex *to,
+			 TimingArcSet *arc_set,
+			 bool is_check,
+			 bool is_bidirect_inst_path) :
+  from_(from),
+  to_(to),
+  arc_set_(arc_set),
+  edge_(nullptr),
+  is_check_(is_check),
+  is_bidirect_inst_path_(is_bidirect_inst_path)
+{
+}
+
+// Two pass parallel construction.
+// The first pass counts the vertices of each instance in parallel.
+// Vertices are then allocated serially in instance order so vertex
+// ids are the same as serial construction. The second pass
+// initializes the vertices and finds the instance edges in parallel.
+void
+Graph::makeVerticesAndEdgesParallel()
+{
+  InstanceSeq insts;
+  LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
+  while (leaf_iter->hasNext())
+    insts.push_back(leaf_iter->next());
   delete leaf_iter;
-  makePinVertices(network_->topInstance());
+  insts.push_back(network_->topInstance());
+  size_t inst_count = insts.size();
+
+  Vector<size_t> vertex_counts(inst_count);
+  dispatchRanges(inst_count, [&] (size_t from, size_t to) {
+    for (size_t i = from; i < to; i++)
+      vertex_counts[i] = pinVertexCount(insts[i]);
+  });
+
+  // Allocate vertices and slews serially in instance order.
+  Vector<size_t> vertex_offsets(inst_count);
+  VertexSeq vertices;
+  for (size_t i = 0; i < inst_count; i++) {
+    vertex_offsets[i] = vertices.size();
+    for (size_t j = 0; j < vertex_counts[i]; j++) {
+      Vertex *vertex = vertices_->make();
+      makeVertexSlews(vertex);
+      vertices.push_back(vertex);
+    }
+  }
+
+  dispatchRanges(inst_count, [&] (size_t from, size_t to) {
+    for (size_t i = from; i < to; i++)
+      initPinVertices(insts[i], &vertices[vertex_offsets[i]]);
+  });
+
+  for (Vertex *vertex : vertices) {
+    if (vertex->isRegClk())
+      reg_clk_vertices_->insert(vertex);
+    if (vertex->isBidirectDriver())
+      pin_bidirect_drvr_vertex_map_[vertex->pin()] = vertex;
+  }
+
+  // The top instance has no timing arcs.
+  size_t leaf_count = inst_count - 1;
+  Vector<PendingEdgeSeq> inst_edges(leaf_count);
+  dispatchRanges(leaf_count, [&] (size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+      const Instance *inst = insts[i];
+      LibertyCell *cell = network_->libertyCell(inst);
+      if (cell)
+	findPortInstanceEdges(inst, cell, nullptr, inst_edges[i]);
+    }
+  });
+  makePendingEdges(inst_edges);
+}
+
+size_t
+Graph::pinVertexCount(const Instance *inst) const
+{
+  size_t count = 0;
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    Pin *pin = pin_iter->next();
+    PortDirection *dir = network_->direction(pin);
+    if (!dir->isPowerGround())
+      count += dir->isBidirect() ? 2 : 1;
+  }
+  delete pin_iter;
+  return count;
+}
+
+// Parallel version of makePinVertices using vertices allocated
+// by makeVerticesAndEdgesParallel.
+void
+Graph::initPinVertices(const Instance *inst,
+		       Vertex **vertices)
+{
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    Pin *pin = pin_iter->next();
+    PortDirection *dir = network_->direction(pin);
+    if (!dir->isPowerGround()) {
+      bool is_reg_clk = network_->isRegClkPin(pin);
+      Vertex *vertex = *vertices++;
+      vertex->init(pin, false, is_reg_clk);
+      network_->setVertexId(pin, id(vertex));
+      if (dir->isBidirect()) {
+	Vertex *bidir_drvr_vertex = *vertices++;
+	bidir_drvr_vertex->init(pin, true, is_reg_clk);
+      }
+    }
+  }
+  delete pin_iter;
+}
+
+// Make edges found in parallel. Edges are allocated serially in
+// order so edge and arc delay ids are the same as serial construction.
+// Edges in different sequences must not share vertices so they can
+// be linked in parallel.
+void
+Graph::makePendingEdges(Vector<PendingEdgeSeq> &edges_seq)
+{
+  for (PendingEdgeSeq &edges : edges_seq) {
+    for (PendingEdge &pending : edges)
+      pending.edge_ = edges_->make();
+  }
+
+  dispatchRanges(edges_seq.size(), [&] (size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+      for (PendingEdge &pending : edges_seq[i]) {
+	Edge *edge = pending.edge_;
+	edge->init(id(pending.from_), id(pending.to_), pending.arc_set_);
+	linkEdge(edge, pending.from_, pending.to_);
+	if (pending.is_bidirect_inst_path_)
+	  edge->setIsBidirectInstPath(true);
+	if (pending.is_check_) {
+	  pending.to_->setHasChecks(true);
+	  pending.from_->setIsCheckClk(true);
+	}
+      }
+    }
+  });
+
+  for (PendingEdgeSeq &edges : edges_seq) {
+    for (PendingEdge &pending : edges) {
+      makeEdgeArcDelays(pending.edge_);
+      arc_count_ += pending.arc_set_->arcCount();
+    }
+  }
+}
+
+// Call fn(from, to) for thread_count_ index ranges in parallel.
+void
+Graph::dispatchRanges(size_t count,
+		      const std::function<void (size_t from,
+						size_t to)> &fn)
+{
+  size_t thread_count = thread_count_;
+  if (thread_count == 1 || count < thread_count)
+    fn(0, count);
+  else {
+    size_t from = 0;
+    size_t chunk_size = count / thread_count;
+    for (size_t k = 0; k < thread_count; k++) {
+      // Last thread gets the left overs.
+      size_t to = (k == thread_count - 1) ? count : from + chunk_size;
+      dispatch_queue_->dispatch( [=, &fn](int) { fn(from, to); });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+  }
 }
 
 class FindNetDrvrLoadCounts : public PinVisitor
@@ -184,6 +385,26 @@ void
 Graph::makePortInstanceEdges(const Instance *inst,
 			     LibertyCell *cell,
 			     LibertyPort *from_to_port)
+{
+  PendingEdgeSeq edges;
+  findPortInstanceEdges(inst, cell, from_to_port, edges);
+  for (PendingEdge &pending : edges) {
+    Edge *edge = makeEdge(pending.from_, pending.to_, pending.arc_set_);
+    if (pending.is_bidirect_inst_path_)
+      edge->setIsBidirectInstPath(true);
+    if (pending.is_check_) {
+      pending.to_->setHasChecks(true);
+      pending.from_->setIsCheckClk(true);
+    }
+  }
+}
+
+void
+Graph::findPortInstanceEdges(const Instance *inst,
+			     LibertyCell *cell,
+			     LibertyPort *from_to_port,
+			     // Return value.
+			     PendingEdgeSeq &edges) const
 {
   for (TimingArcSet *arc_set : cell->timingArcSets()) {
     LibertyPort *from_port = arc_set->from();
@@ -208,21 +429,16 @@ Graph::makePortInstanceEdges(const Instance *inst,
   	  bool is_check = arc_set->role()->isTimingCheck();
 	  if (to_bidirect_drvr_vertex &&
 	      !is_check)
-	    makeEdge(from_vertex, to_bidirect_drvr_vertex, arc_set);
-	  else if (to_vertex) {
-	    makeEdge(from_vertex, to_vertex, arc_set);
-	    if (is_check) {
-	      to_vertex->setHasChecks(true);
-	      from_vertex->setIsCheckClk(true);
-	    }
-	  }
-	  if (from_bidirect_drvr_vertex && to_vertex) {
+	    edges.push_back(PendingEdge(from_vertex, to_bidirect_drvr_vertex,
+					arc_set, false, false));
+	  else if (to_vertex)
+	    edges.push_back(PendingEdge(from_vertex, to_vertex,
+					arc_set, is_check, false));
+	  if (from_bidirect_drvr_vertex && to_vertex)
 	    // Internal path from bidirect output back into the
 	    // instance.
-	    Edge *edge = makeEdge(from_bidirect_drvr_vertex, to_vertex,
-				  arc_set);
-	    edge->setIsBidirectInstPath(true);
-	  }
+	    edges.push_back(PendingEdge(from_bidirect_drvr_vertex, to_vertex,
+					arc_set, false, true));
 	}
       }
     }
@@ -232,14 +448,126 @@ Graph::makePortInstanceEdges(const Instance *inst,
 void
 Graph::makeWireEdges()
 {
-  PinSet visited_drvrs;
-  LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
-  while (inst_iter->hasNext()) {
-    Instance *inst = inst_iter->next();
-    makeInstDrvrWireEdges(inst, visited_drvrs);
+  if (thread_count_ > 1)
+    makeWireEdgesParallel();
+  else {
+    PinSet visited_drvrs;
+    LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
+    while (inst_iter->hasNext()) {
+      Instance *inst = inst_iter->next();
+      makeInstDrvrWireEdges(inst, visited_drvrs);
+    }
+    delete inst_iter;
+    makeInstDrvrWireEdges(network_->topInstance(), visited_drvrs);
   }
+}
+
+// Wire edges of a net found by a parallel graph construction pass
+// and the vertex id of the driver that owns the net.
+class PendingNetEdges
+{
+public:
+  PendingNetEdges(VertexId owner_id);
+
+  VertexId owner_id_;
+  PendingEdgeSeq edges_;
+};
+
+PendingNetEdges::PendingNetEdges(VertexId owner_id) :
+  owner_id_(owner_id)
+{
+}
+
+// Each net is owned by the driver with the lowest vertex id, which is
+// the first driver visited by serial construction. The first driver
+// to walk a net claims it for the owner and marks the other drivers
+// so they do not walk the net again. Nets are made in owner vertex id
+// order so edge ids are the same as serial construction. Nets do not
+// share vertices so the edges of each net can be linked in parallel.
+void
+Graph::makeWireEdgesParallel()
+{
+  InstanceSeq insts;
+  LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
+  while (inst_iter->hasNext())
+    insts.push_back(inst_iter->next());
   delete inst_iter;
-  makeInstDrvrWireEdges(network_->topInstance(), visited_drvrs);
+  insts.push_back(network_->topInstance());
+
+  // Vertex ids are dense because no vertices have been deleted yet.
+  size_t claimed_size = vertices_->size() + 1;
+  std::atomic<bool> *claimed = new std::atomic<bool>[claimed_size];
+  for (size_t i = 0; i < claimed_size; i++)
+    claimed[i] = false;
+  Vector<PendingNetEdgesSeq> inst_nets(insts.size());
+  dispatchRanges(insts.size(), [&] (size_t from, size_t to) {
+    for (size_t i = from; i < to; i++)
+      findInstDrvrWireEdges(insts[i], claimed, inst_nets[i]);
+  });
+  delete [] claimed;
+
+  PendingNetEdgesSeq nets;
+  for (PendingNetEdgesSeq &inst_nets1 : inst_nets) {
+    for (PendingNetEdges &net : inst_nets1)
+      nets.push_back(std::move(net));
+  }
+  std::sort(nets.begin(), nets.end(),
+	    [] (const PendingNetEdges &net1,
+		const PendingNetEdges &net2) {
+	      return net1.owner_id_ < net2.owner_id_;
+	    });
+  Vector<PendingEdgeSeq> net_edges;
+  for (PendingNetEdges &net : nets)
+    net_edges.push_back(std::move(net.edges_));
+  makePendingEdges(net_edges);
+}
+
+void
+Graph::findInstDrvrWireEdges(const Instance *inst,
+			     std::atomic<bool> *claimed,
+			     // Return value.
+			     PendingNetEdgesSeq &nets) const
+{
+  TimingArcSet *arc_set = TimingArcSet::wireTimingArcSet();
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    Pin *drvr_pin = pin_iter->next();
+    VertexId drvr_id = network_->vertexId(drvr_pin);
+    if (network_->isDriver(drvr_pin)
+	&& !claimed[drvr_id]) {
+      PinSeq loads, drvrs;
+      PinSet visited_drvrs;
+      FindNetDrvrLoads visitor(drvr_pin, visited_drvrs, loads, drvrs, network_);
+      network_->visitConnectedPins(drvr_pin, visitor);
+      VertexId owner_id = drvr_id;
+      for (auto drvr : drvrs) {
+	VertexId id = network_->vertexId(drvr);
+	if (id != vertex_id_null && id < owner_id)
+	  owner_id = id;
+      }
+      // Drivers walking the same net at the same time race to claim
+      // the owner, and only the winner makes the edges.
+      if (!claimed[owner_id].exchange(true)) {
+	for (auto drvr : drvrs) {
+	  VertexId id = network_->vertexId(drvr);
+	  if (id != vertex_id_null)
+	    claimed[id] = true;
+	}
+	nets.push_back(PendingNetEdges(owner_id));
+	PendingEdgeSeq &edges = nets.back().edges_;
+	for (auto drvr : drvrs) {
+	  for (auto load : loads) {
+	    Vertex *from_vertex, *to_vertex;
+	    if (drvr != load
+		&& wireEdgeVertices(drvr, load, from_vertex, to_vertex))
+	      edges.push_back(PendingEdge(from_vertex, to_vertex, arc_set,
+					  false, false));
+	  }
+	}
+      }
+    }
+  }
+  delete pin_iter;
 }
 
 void
@@ -336,17 +664,25 @@ void
 Graph::makeWireEdge(Pin *from_pin,
 		    Pin *to_pin)
 {
-  TimingArcSet *arc_set = TimingArcSet::wireTimingArcSet();
-  Vertex *from_vertex, *from_bidirect_drvr_vertex;
+  Vertex *from_vertex, *to_vertex;
+  if (wireEdgeVertices(from_pin, to_pin, from_vertex, to_vertex))
+    makeEdge(from_vertex, to_vertex, TimingArcSet::wireTimingArcSet());
+}
+
+bool
+Graph::wireEdgeVertices(const Pin *from_pin,
+			const Pin *to_pin,
+			// Return values.
+			Vertex *&from_vertex,
+			Vertex *&to_vertex) const
+{
+  Vertex *from_bidirect_drvr_vertex;
   pinVertices(from_pin, from_vertex, from_bidirect_drvr_vertex);
-  Vertex *to_vertex = pinLoadVertex(to_pin);
-  if (from_vertex && to_vertex) {
-    // From and/or to can be bidirect, but edge is always from driver to load.
-    if (from_bidirect_drvr_vertex)
-      makeEdge(from_bidirect_drvr_vertex, to_vertex, arc_set);
-    else
-      makeEdge(from_vertex, to_vertex, arc_set);
-  }
+  to_vertex = pinLoadVertex(to_pin);
+  // From and/or to can be bidirect, but edge is always from driver to load.
+  if (from_bidirect_drvr_vertex)
+    from_vertex = from_bidirect_drvr_vertex;
+  return from_vertex && to_vertex;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -500,7 +836,366 @@ Graph::deleteOutEdge(Vertex *vertex,
 
 ////////////////////////////////////////////////////////////////
 
-Arrival *
+#if COMPACT_ARRIVALS
+
+// Compact delay arrays are uint16_t arrays with a header followed by
+// one offset per delay.
+//  header: float base, uint32_t count
+//  delay = base + offset * compact_quantum
+// Offsets above compact_offset_max encode infinite and unset delays.
+// The quantum is fixed so the error is at most compact_quantum / 2.
+// Arrays with fewer than compact_min_count delays, or whose finite
+// delays span more than compact_offset_max quanta, store floats instead.
+
+static constexpr uint32_t compact_header_size = 4;
+static constexpr uint32_t compact_min_count = 5;
+// 0.1ps in seconds.
+static constexpr float compact_quantum = 1e-13;
+static constexpr uint16_t compact_offset_max = 0xfffc;
+static constexpr uint16_t compact_unset = 0xfffd;
+static constexpr uint16_t compact_neg_inf = 0xfffe;
+static constexpr uint16_t compact_pos_inf = 0xffff;
+
+static uint32_t
+delayArraySize(uint32_t count,
+	       bool compact)
+{
+  if (compact)
+    return compact_header_size + count;
+  else
+    return count * sizeof(float) / sizeof(uint16_t);
+}
+
+static float
+floatValue(const uint16_t *array,
+	   uint32_t index)
+{
+  float value;
+  memcpy(&value, array + index * 2, sizeof(float));
+  return value;
+}
+
+static void
+floatSet(uint16_t *array,
+	 uint32_t index,
+	 float value)
+{
+  memcpy(array + index * 2, &value, sizeof(float));
+}
+
+static float
+compactBase(const uint16_t *array)
+{
+  float base;
+  memcpy(&base, array, sizeof(float));
+  return base;
+}
+
+static uint32_t
+compactCount(const uint16_t *array)
+{
+  uint32_t count;
+  memcpy(&count, array + 2, sizeof(uint32_t));
+  return count;
+}
+
+static void
+compactInit(uint16_t *array,
+	    uint32_t count)
+{
+  float zero = 0.0;
+  memcpy(array, &zero, sizeof(float));
+  memcpy(array + 2, &count, sizeof(uint32_t));
+  std::fill(array + compact_header_size,
+	    array + compact_header_size + count,
+	    compact_unset);
+}
+
+// Unset delays are NaN so they can be skipped when re-encoding.
+static Delay
+compactDecode(const uint16_t *array,
+	      uint32_t index)
+{
+  uint16_t offset = array[compact_header_size + index];
+  switch (offset) {
+  case compact_unset:
+    return std::numeric_limits<float>::quiet_NaN();
+  case compact_neg_inf:
+    return -INF;
+  case compact_pos_inf:
+    return INF;
+  default:
+    return compactBase(array) + offset * compact_quantum;
+  }
+}
+
+// Return false if value is not in the range of base.
+static bool
+compactOffset(float base,
+	      Delay value,
+	      // Return value.
+	      uint16_t &offset)
+{
+  if (std::isnan(value))
+    offset = compact_unset;
+  else if (value >= INF)
+    offset = compact_pos_inf;
+  else if (value <= -INF)
+    offset = compact_neg_inf;
+  else {
+    float offset1 = std::round((value - base) / compact_quantum);
+    if (offset1 < 0.0 || offset1 > compact_offset_max)
+      return false;
+    offset = static_cast<uint16_t>(offset1);
+  }
+  return true;
+}
+
+// Return false if the finite values span too many quanta to be compact.
+static bool
+compactFits(const Delay *values,
+	    uint32_t count,
+	    // Return value.
+	    float &base)
+{
+  float min = INF;
+  float max = -INF;
+  for (uint32_t i = 0; i < count; i++) {
+    Delay value = values[i];
+    if (value > -INF && value < INF) {
+      min = std::min(min, value);
+      max = std::max(max, value);
+    }
+  }
+  if (min < INF) {
+    base = min;
+    return std::round((max - min) / compact_quantum) <= compact_offset_max;
+  }
+  else {
+    base = 0.0;
+    return true;
+  }
+}
+
+static void
+makeDelays(ArrivalsTable &table,
+	   std::mutex &lock,
+	   uint32_t count,
+	   // Return values.
+	   ArrivalId &id,
+	   bool &compact)
+{
+  compact = count >= compact_min_count;
+  uint16_t *array;
+  {
+    UniqueLock lock1(lock);
+    table.make(delayArraySize(count, compact), array, id);
+  }
+  if (compact)
+    compactInit(array, count);
+  else {
+    for (uint32_t i = 0; i < count; i++)
+      floatSet(array, i, 0.0);
+  }
+}
+
+static Delay
+delayValue(const ArrivalsTable &table,
+	   ArrivalId id,
+	   bool compact,
+	   uint32_t index)
+{
+  const uint16_t *array = table.pointer(id);
+  if (compact) {
+    Delay value = compactDecode(array, index);
+    return std::isnan(value) ? 0.0 : value;
+  }
+  else
+    return floatValue(array, index);
+}
+
+// Compact arrays that no longer fit are converted to floats,
+// which changes id.
+static void
+setDelays(ArrivalsTable &table,
+	  std::mutex &lock,
+	  const Delay *values,
+	  uint32_t count,
+	  // Return values.
+	  ArrivalId &id,
+	  bool &compact)
+{
+  uint16_t *array = table.pointer(id);
+  if (compact) {
+    float base;
+    if (compactFits(values, count, base)) {
+      memcpy(array, &base, sizeof(float));
+      for (uint32_t i = 0; i < count; i++)
+	compactOffset(base, values[i], array[compact_header_size + i]);
+      return;
+    }
+    {
+      UniqueLock lock1(lock);
+      table.destroy(id, delayArraySize(count, true));
+      table.make(delayArraySize(count, false), array, id);
+    }
+    compact = false;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    Delay value = values[i];
+    floatSet(array, i, std::isnan(value) ? 0.0 : value);
+  }
+}
+
+static void
+setDelay(ArrivalsTable &table,
+	 std::mutex &lock,
+	 uint32_t index,
+	 Delay value,
+	 // Return values.
+	 ArrivalId &id,
+	 bool &compact)
+{
+  uint16_t *array = table.pointer(id);
+  if (compact) {
+    if (!compactOffset(compactBase(array), value,
+		       array[compact_header_size + index])) {
+      // Out of range so re-encode the array.
+      uint32_t count = compactCount(array);
+      std::vector<Delay> values(count);
+      for (uint32_t i = 0; i < count; i++)
+	values[i] = compactDecode(array, i);
+      values[index] = value;
+      setDelays(table, lock, values.data(), count, id, compact);
+    }
+  }
+  else
+    floatSet(array, index, value);
+}
+
+void
+Graph::makeArrivals(Vertex *vertex,
+		    uint32_t count)
+{
+  if (vertex->arrivals() != arrival_null)
+    debugPrint(debug_, "leaks", 617, "arrival leak");
+  ArrivalId id;
+  bool compact;
+  makeDelays(arrivals_, arrivals_lock_, count, id, compact);
+  vertex->setArrivals(id);
+  vertex->arrivals_compact_ = compact;
+}
+
+Arrival
+Graph::arrival(Vertex *vertex,
+	       uint32_t index) const
+{
+  return delayValue(arrivals_, vertex->arrivals(),
+		    vertex->arrivals_compact_, index);
+}
+
+void
+Graph::setArrival(Vertex *vertex,
+		  uint32_t index,
+		  const Arrival &arrival)
+{
+  ArrivalId id = vertex->arrivals();
+  bool compact = vertex->arrivals_compact_;
+  setDelay(arrivals_, arrivals_lock_, index, arrival, id, compact);
+  vertex->setArrivals(id);
+  vertex->arrivals_compact_ = compact;
+}
+
+void
+Graph::setArrivals(Vertex *vertex,
+		   const Arrival *arrivals,
+		   uint32_t count)
+{
+  ArrivalId id = vertex->arrivals();
+  bool compact = vertex->arrivals_compact_;
+  setDelays(arrivals_, arrivals_lock_, arrivals, count, id, compact);
+  vertex->setArrivals(id);
+  vertex->arrivals_compact_ = compact;
+}
+
+void
+Graph::deleteArrivals(Vertex *vertex,
+                      uint32_t count)
+{
+  {
+    UniqueLock lock(arrivals_lock_);
+    arrivals_.destroy(vertex->arrivals(),
+		      delayArraySize(count, vertex->arrivals_compact_));
+  }
+  vertex->setArrivals(arrival_null);
+}
+
+float
+Graph::arrivalResolution(Vertex *vertex) const
+{
+  if (vertex->hasArrivals() && vertex->arrivals_compact_)
+    return compact_quantum / 2.0;
+  else
+    return 0.0;
+}
+
+void
+Graph::makeRequireds(Vertex *vertex,
+                     uint32_t count)
+{
+  if (vertex->requireds() != arrival_null)
+    debugPrint(debug_, "leaks", 617, "required leak");
+  ArrivalId id;
+  bool compact;
+  makeDelays(requireds_, requireds_lock_, count, id, compact);
+  vertex->setRequireds(id);
+  vertex->requireds_compact_ = compact;
+}
+
+Required
+Graph::required(Vertex *vertex,
+		uint32_t index) const
+{
+  return delayValue(requireds_, vertex->requireds(),
+		    vertex->requireds_compact_, index);
+}
+
+void
+Graph::setRequired(Vertex *vertex,
+		   uint32_t index,
+		   const Required &required)
+{
+  ArrivalId id = vertex->requireds();
+  bool compact = vertex->requireds_compact_;
+  setDelay(requireds_, requireds_lock_, index, required, id, compact);
+  vertex->setRequireds(id);
+  vertex->requireds_compact_ = compact;
+}
+
+void
+Graph::deleteRequireds(Vertex *vertex,
+                       uint32_t count)
+{
+  {
+    UniqueLock lock(requireds_lock_);
+    requireds_.destroy(vertex->requireds(),
+		       delayArraySize(count, vertex->requireds_compact_));
+  }
+  vertex->setRequireds(arrival_null);
+}
+
+float
+Graph::requiredResolution(Vertex *vertex) const
+{
+  if (vertex->hasRequireds() && vertex->requireds_compact_)
+    return compact_quantum / 2.0;
+  else
+    return 0.0;
+}
+
+#else
+
+void
 Graph::makeArrivals(Vertex *vertex,
 		    uint32_t count)
 {
@@ -513,13 +1208,29 @@ Graph::makeArrivals(Vertex *vertex,
     arrivals_.make(count, arrivals, id);
   }
   vertex->setArrivals(id);
-  return arrivals;
 }
 
-Arrival *
-Graph::arrivals(Vertex *vertex)
+Arrival
+Graph::arrival(Vertex *vertex,
+	       uint32_t index) const
+{
+  return arrivals_.pointer(vertex->arrivals())[index];
+}
+
+void
+Graph::setArrival(Vertex *vertex,
+		  uint32_t index,
+		  const Arrival &arrival)
+{
+  arrivals_.pointer(vertex->arrivals())[index] = arrival;
+}
+
+void
+Graph::setArrivals(Vertex *vertex,
+		   const Arrival *arrivals,
+		   uint32_t count)
 {
-  return arrivals_.pointer(vertex->arrivals());
+  std::copy(arrivals, arrivals + count, arrivals_.pointer(vertex->arrivals()));
 }
 
 void
@@ -533,7 +1244,13 @@ Graph::deleteArrivals(Vertex *vertex,
   vertex->setArrivals(arrival_null);
 }
 
-Required *
+float
+Graph::arrivalResolution(Vertex *) const
+{
+  return 0.0;
+}
+
+void
 Graph::makeRequireds(Vertex *vertex,
                      uint32_t count)
 {
@@ -546,13 +1263,21 @@ Graph::makeRequireds(Vertex *vertex,
     requireds_.make(count, requireds, id);
   }
   vertex->setRequireds(id);
-  return requireds;
 }
 
-Required *
-Graph::requireds(Vertex *vertex)
+Required
+Graph::required(Vertex *vertex,
+		uint32_t index) const
+{
+  return requireds_.pointer(vertex->requireds())[index];
+}
+
+void
+Graph::setRequired(Vertex *vertex,
+		   uint32_t index,
+		   const Required &required)
 {
-  return requireds_.pointer(vertex->requireds());
+  requireds_.pointer(vertex->requireds())[index] = required;
 }
 
 void
@@ -566,6 +1291,14 @@ Graph::deleteRequireds(Vertex *vertex,
   vertex->setRequireds(arrival_null);
 }
 
+float
+Graph::requiredResolution(Vertex *) const
+{
+  return 0.0;
+}
+
+#endif
+
 void
 Graph::clearArrivals()
 {
@@ -658,6 +1391,15 @@ Graph::makeEdge(Vertex *from,
   edge->init(id(from), id(to), arc_set);
   makeEdgeArcDelays(edge);
   arc_count_ += arc_set->arcCount();
+  linkEdge(edge, from, to);
+  return edge;
+}
+
+void
+Graph::linkEdge(Edge *edge,
+		Vertex *from,
+		Vertex *to)
+{
   // Add out edge to from vertex.
   EdgeId next = from->out_edges_;
   edge->vertex_out_next_ = next;
@@ -670,8 +1412,6 @@ Graph::makeEdge(Vertex *from,
   // Add in edge to to vertex.
   edge->vertex_in_link_ = to->in_edges_;
   to->in_edges_ = edge_id;
-
-  return edge;
 }
 
 void
@@ -1086,6 +1826,10 @@ Vertex::init(Pin *pin,
   bfs_in_queue_ = 0;
   crpr_path_pruning_disabled_ = false;
   requireds_pruned_ = false;
+#if COMPACT_ARRIVALS
+  arrivals_compact_ = false;
+  requireds_compact_ = false;
+#endif
 }
 
 void
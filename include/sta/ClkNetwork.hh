@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <map>
+#include <vector>
+
 #include "Map.hh"
 #include "Set.hh"
 #include "StaState.hh"
@@ -25,8 +28,14 @@
 
 namespace sta {
 
-typedef Map<const Pin*, ClockSet> PinClksMap;
 typedef Map<const Clock *, PinSet> ClkPinsMap;
+// Distinct sets of clocks indexed by clock set id.
+typedef std::vector<ClockSet> ClkSetSeq;
+// Clock set id indexed by pin vertex id.
+typedef std::vector<int> ClkSetIds;
+// (clock set id, clock index) -> clock set id
+typedef std::map<std::pair<int, int>, int> ClkSetExtendMap;
+typedef std::vector<bool> VertexVisited;
 
 class Sta;
 
@@ -58,14 +67,27 @@ protected:
 
 private:
   void findClkPins();
-  void findClkPins(bool ideal_only,
-		   PinClksMap &clk_pin_map);
+  void findClkVertices(Clock *clk,
+		       bool ideal_only,
+		       VertexVisited &visited,
+		       // Return value.
+		       VertexSeq &clk_vertices);
+  void recordClkPins(ClockSeq &clks,
+		     Vector<VertexSeq> &clk_vertices,
+		     ClkSetExtendMap &extend_map,
+		     ClkSetIds &pin_clk_sets);
+  int clkSetId(const Pin *pin,
+	       const ClkSetIds &pin_clk_sets) const;
 
   bool clk_pins_valid_;
-  // pin -> clks
-  PinClksMap pin_clks_map_;
-  // pin -> ideal clks
-  PinClksMap pin_ideal_clks_map_;
+  // Pins with the same clocks share a clock set so the clocks of
+  // every pin only take one int indexed by the pin's vertex id.
+  // clk_sets_[0] is the empty set.
+  ClkSetSeq clk_sets_;
+  // pin vertex id -> clk set id
+  ClkSetIds pin_clk_sets_;
+  // pin vertex id -> ideal clk set id
+  ClkSetIds pin_ideal_clk_sets_;
   // clock -> pins
   ClkPinsMap clk_pins_map_;
 };
@@ -112,6 +112,7 @@ public:
   virtual Cell *cell(const Instance *instance) const;
   virtual Instance *parent(const Instance *instance) const;
   virtual bool isLeaf(const Instance *instance) const;
+  virtual ObjectId id(const Instance *instance) const;
   virtual Instance *findChild(const Instance *parent,
 			      const char *name) const;
   virtual Pin *findPin(const Instance *instance,
@@ -131,6 +132,7 @@ public:
   virtual Term *term(const Pin *pin) const;
   virtual Port *port(const Pin *pin) const;
   virtual PortDirection *direction(const Pin *pin) const;
+  virtual ObjectId id(const Pin *pin) const;
   virtual VertexId vertexId(const Pin *pin) const;
   virtual void setVertexId(Pin *pin,
 			   VertexId id);
@@ -145,6 +147,7 @@ public:
 				    NetSeq *nets) const;
   virtual const char *name(const Net *net) const;
   virtual Instance *instance(const Net *net) const;
+  virtual ObjectId id(const Net *net) const;
   virtual bool isPower(const Net *net) const;
   virtual bool isGround(const Net *net) const;
   virtual NetPinIterator *pinIterator(const Net *net) const;
@@ -258,6 +261,10 @@ protected:
   NetSet constant_nets_[2];  // LogicValue::zero/one
   LinkNetworkFunc *link_func_;
   CellNetworkViewMap cell_network_view_map_;
+  // Ids are not reused when objects are deleted.
+  ObjectId instance_id_count_;
+  ObjectId pin_id_count_;
+  ObjectId net_id_count_;
 
 private:
   friend class ConcreteLibertyLibraryIterator;
@@ -269,6 +276,7 @@ public:
   const char *name() const { return name_; }
   Cell *cell() const;
   ConcreteInstance *parent() const { return parent_; }
+  ObjectId id() const { return id_; }
   ConcretePin *findPin(const char *port_name) const;
   ConcretePin *findPin(const Port *port) const;
   ConcreteNet *findNet(const char *net_name) const;
@@ -291,12 +299,14 @@ public:
 protected:
   ConcreteInstance(ConcreteCell *cell,
 		   const char *name,
-		   ConcreteInstance *parent);
+		   ConcreteInstance *parent,
+		   ObjectId id);
   ~ConcreteInstance();
 
   ConcreteCell *cell_;
   const char *name_;
   ConcreteInstance *parent_;
+  ObjectId id_;
   // Array of pins indexed by pin->port->index().
   ConcretePin **pins_;
   ConcreteInstanceChildMap *children_;
@@ -305,6 +315,7 @@ protected:
 private:
   friend class ConcreteNetwork;
   friend class ConcreteInstancePinIterator;
+  friend class NetworkSnapshotWriter;
 };
 
 class ConcretePin
@@ -315,6 +326,7 @@ public:
   ConcreteNet *net() const { return net_; }
   ConcretePort *port() const { return port_; }
   ConcreteTerm *term() const { return term_; }
+  ObjectId id() const { return id_; }
   VertexId vertexId() const { return vertex_id_; }
   void setVertexId(VertexId id);
 
@@ -322,7 +334,8 @@ protected:
   ~ConcretePin() {}
   ConcretePin(ConcreteInstance *instance,
 	      ConcretePort *port,
-	      ConcreteNet *net);
+	      ConcreteNet *net,
+	      ObjectId id);
 
   ConcreteInstance *instance_;
   ConcretePort *port_;
@@ -331,6 +344,7 @@ protected:
   // Doubly linked list of net pins.
   ConcretePin *net_next_;
   ConcretePin *net_prev_;
+  ObjectId id_;
   VertexId vertex_id_;
 
 private:
@@ -367,6 +381,7 @@ class ConcreteNet
 public:
   const char *name() const { return name_; }
   ConcreteInstance *instance() const { return instance_; }
+  ObjectId id() const { return id_; }
   void addPin(ConcretePin *pin);
   void deletePin(ConcretePin *pin);
   void addTerm(ConcreteTerm *term);
@@ -376,10 +391,12 @@ public:
 
 protected:
   ConcreteNet(const char *name,
-	      ConcreteInstance *instance);
+	      ConcreteInstance *instance,
+	      ObjectId id);
   ~ConcreteNet();
   const char *name_;
   ConcreteInstance *instance_;
+  ObjectId id_;
   // Pointer to head of linked list of pins.
   ConcretePin *pins_;
   // Pointer to head of linked list of terminals.
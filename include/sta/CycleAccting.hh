@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "UnorderedSet.hh"
 #include "MinMax.hh"
 #include "TimingRole.hh"
@@ -54,13 +56,27 @@ public:
   void clear();
   // Find the cycle accounting info for paths that start at src clock
   // edge and end at target clock edge.
+  // Caller must serialize calls.
   CycleAccting *cycleAccting(const ClockEdge *src,
 			     const ClockEdge *tgt);
+  // Return the cycle accounting found by a previous call to cycleAccting
+  // or null. Safe to call from multiple threads without locking.
+  CycleAccting *findCycleAccting(const ClockEdge *src,
+				 const ClockEdge *tgt) const;
   void reportClkToClkMaxCycleWarnings(Report *report);
 
 private:
+  void ensureTable();
+  void deleteTable();
+
   Sdc *sdc_;
   CycleAcctingSet cycle_acctings_;
+  // Src clock edge index -> tgt clock edge index -> cycle accting.
+  // Rows are allocated when the first cycle accting from the src
+  // edge is found.
+  std::atomic<std::atomic<CycleAccting*>*> *table_;
+  // Published after table_ is allocated.
+  std::atomic<int> table_edge_count_;
 };
 
 class CycleAccting
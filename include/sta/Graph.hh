@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
+#include <functional>
 
 #include "Iterator.hh"
 #include "Map.hh"
@@ -35,20 +37,31 @@ namespace sta {
 
 class MinMax;
 class Sdc;
+class PendingEdge;
+class PendingNetEdges;
 
 enum class LevelColor { white, gray, black };
 
 typedef ArrayTable<Delay> DelayTable;
 typedef ObjectTable<Vertex> VertexTable;
 typedef ObjectTable<Edge> EdgeTable;
+#if COMPACT_ARRIVALS
+// Arrivals/requireds are stored as 16 bit offsets from a per-vertex
+// base delay with a fixed quantum, or as floats when they do not fit.
+typedef ArrayTable<uint16_t> ArrivalsTable;
+typedef ArrayTable<uint16_t> RequiredsTable;
+#else
 typedef ArrayTable<Arrival> ArrivalsTable;
 typedef ArrayTable<Required> RequiredsTable;
+#endif
 typedef ArrayTable<PathVertexRep> PrevPathsTable;
 typedef Map<const Pin*, Vertex*> PinVertexMap;
 typedef Iterator<Edge*> VertexEdgeIterator;
 typedef Map<const Pin*, float*> WidthCheckAnnotations;
 typedef Map<const Pin*, float*> PeriodCheckAnnotations;
 typedef Vector<DelayTable*> DelayTableSeq;
+typedef Vector<PendingEdge> PendingEdgeSeq;
+typedef Vector<PendingNetEdges> PendingNetEdgesSeq;
 typedef ObjectId EdgeId;
 typedef ObjectId ArrivalId;
 typedef ObjectId PrevPathId;
@@ -98,16 +111,33 @@ public:
   virtual void deleteVertex(Vertex *vertex);
   bool hasFaninOne(Vertex *vertex) const;
   VertexId vertexCount() { return vertices_->size(); }
-  Arrival *makeArrivals(Vertex *vertex,
-			uint32_t count);
-  Arrival *arrivals(Vertex *vertex);
+  // Arrivals and requireds are indexed by TagGroup arrival index.
+  void makeArrivals(Vertex *vertex,
+		    uint32_t count);
+  Arrival arrival(Vertex *vertex,
+		  uint32_t index) const;
+  void setArrival(Vertex *vertex,
+		  uint32_t index,
+		  const Arrival &arrival);
+  // Set all count arrivals.
+  void setArrivals(Vertex *vertex,
+		   const Arrival *arrivals,
+		   uint32_t count);
   void deleteArrivals(Vertex *vertex,
                       uint32_t count);
-  Required *makeRequireds(Vertex *vertex,
-                          uint32_t count);
-  Required *requireds(Vertex *vertex);
+  void makeRequireds(Vertex *vertex,
+		     uint32_t count);
+  Required required(Vertex *vertex,
+		    uint32_t index) const;
+  void setRequired(Vertex *vertex,
+		   uint32_t index,
+		   const Required &required);
   void deleteRequireds(Vertex *vertex,
                        uint32_t count);
+  // Largest difference between a stored arrival/required and the
+  // value that was set. Zero unless arrivals are compact.
+  float arrivalResolution(Vertex *vertex) const;
+  float requiredResolution(Vertex *vertex) const;
   void clearArrivals();
   size_t arrivalCount() const { return arrivals_.size(); }
   size_t requiredCount() const { return requireds_.size(); }
@@ -206,6 +236,34 @@ public:
 
 protected:
   void makeVerticesAndEdges();
+  // Parallel construction used when thread_count_ > 1.
+  // Vertex and edge ids are the same as serial construction.
+  void makeVerticesAndEdgesParallel();
+  size_t pinVertexCount(const Instance *inst) const;
+  void initPinVertices(const Instance *inst,
+		       Vertex **vertices);
+  void findPortInstanceEdges(const Instance *inst,
+			     LibertyCell *cell,
+			     LibertyPort *from_to_port,
+			     // Return value.
+			     PendingEdgeSeq &edges) const;
+  void makeWireEdgesParallel();
+  void findInstDrvrWireEdges(const Instance *inst,
+			     std::atomic<bool> *claimed,
+			     // Return value.
+			     PendingNetEdgesSeq &nets) const;
+  bool wireEdgeVertices(const Pin *from_pin,
+			const Pin *to_pin,
+			// Return values.
+			Vertex *&from_vertex,
+			Vertex *&to_vertex) const;
+  void makePendingEdges(Vector<PendingEdgeSeq> &edges_seq);
+  void linkEdge(Edge *edge,
+		Vertex *from,
+		Vertex *to);
+  void dispatchRanges(size_t count,
+		      const std::function<void (size_t from,
+						size_t to)> &fn);
   Vertex *makeVertex(Pin *pin,
 		     bool is_bidirect_drvr,
 		     bool is_reg_clk);
@@ -287,6 +345,7 @@ public:
   void setColor(LevelColor color);
   ArrivalId arrivals() { return arrivals_; }
   ArrivalId requireds() { return requireds_; }
+  bool hasArrivals() const { return arrivals_ != arrival_null; }
   bool hasRequireds() const { return requireds_ != arrival_null; }
   PrevPathId prevPaths() const { return prev_paths_; }
   void setPrevPaths(PrevPathId id);
@@ -380,6 +439,11 @@ protected:
   bool has_downstream_clk_pin_:1;
   bool crpr_path_pruning_disabled_:1;
   bool requireds_pruned_:1;
+#if COMPACT_ARRIVALS
+  // Arrivals/requireds are 16 bit offsets rather than floats.
+  bool arrivals_compact_:1;
+  bool requireds_compact_:1;
+#endif
 
   unsigned object_idx_:VertexTable::idx_bits;
 
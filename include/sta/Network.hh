@@ -222,6 +222,9 @@ public:
   virtual LibertyCell *libertyCell(const Instance *instance) const;
   virtual Instance *parent(const Instance *instance) const = 0;
   virtual bool isLeaf(const Instance *instance) const = 0;
+  // Dense id that is unique among the network instances.
+  // Use to index flat tables instead of hashing/comparing pointers.
+  virtual ObjectId id(const Instance *instance) const = 0;
   virtual bool isHierarchical(const Instance *instance) const;
   virtual Instance *findChild(const Instance *parent,
 			      const char *name) const = 0;
@@ -320,6 +323,8 @@ public:
   virtual PinSet *drivers(const Pin *pin);
   virtual bool pinLess(const Pin *pin1,
 		       const Pin *pin2) const;
+  // Dense id that is unique among the network pins.
+  virtual ObjectId id(const Pin *pin) const = 0;
   // Return the id of the pin graph vertex.
   virtual VertexId vertexId(const Pin *pin) const = 0;
   virtual void setVertexId(Pin *pin,
@@ -375,6 +380,8 @@ public:
   int pathNameCmp(const Net *net1,
 		  const Net *net2) const;
   virtual Instance *instance(const Net *net) const = 0;
+  // Dense id that is unique among the network nets.
+  virtual ObjectId id(const Net *net) const = 0;
   // Is net inside of hier_inst?
   virtual bool isInside(const Net *net,
 			const Instance *hier_inst) const;
@@ -0,0 +1,47 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2022, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <functional>
+
+namespace sta {
+
+class ConcreteNetwork;
+
+// A network snapshot is a binary image of a linked ConcreteNetwork.
+// Liberty cells are referenced by library/cell name and must be read
+// before the snapshot. Non-liberty cells (hierarchical modules and
+// black boxes) are defined in the snapshot with their bus/bundle ports.
+// The file is a header followed by 8 byte aligned arrays of fixed
+// size records so it can be used in place from a memory image.
+
+// Throws FileNotWritable.
+void
+writeNetworkSnapshot(const char *filename,
+		     ConcreteNetwork *network);
+
+// Replace the network's top instance with the snapshot design.
+// read_before is called after the file is validated and before the
+// current top instance is replaced.
+// Return true if successful.
+// Throws FileNotReadable.
+bool
+readNetworkSnapshot(const char *filename,
+		    ConcreteNetwork *network,
+		    std::function<void ()> read_before);
+
+} // namespace
@@ -61,7 +61,7 @@ public:
 			  const StaState *sta) = 0;
   virtual void initArrival(const StaState *sta);
   virtual bool arrivalIsInitValue(const StaState *sta) const;
-  virtual const Required &required(const StaState *sta) const = 0;
+  virtual Required required(const StaState *sta) const = 0;
   virtual void setRequired(const Required &required,
 			   const StaState *sta) = 0;
   virtual void initRequired(const StaState *sta);
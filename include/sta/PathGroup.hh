@@ -27,7 +27,7 @@
 namespace sta {
 
 class MinMax;
-class PathEndVisitor;
+class MakePathEnds;
 
 typedef PathEndSeq::Iterator PathGroupIterator;
 typedef Map<const Clock*, PathGroup*> PathGroupClkMap;
@@ -57,6 +57,8 @@ public:
   const MinMax *minMax() const { return min_max_;}
   const PathEndSeq &pathEnds() const { return path_ends_; }
   void insert(PathEnd *path_end);
+  // Insert path ends collected outside the group.
+  void insert(const PathEndSeq &path_ends);
   // Push group_count into path_ends.
   void pushEnds(PathEndSeq *path_ends);
   // Predicates to determine if a PathEnd is worth saving.
@@ -139,11 +141,11 @@ protected:
   void makeGroupPathEnds(ExceptionTo *to,
 			 const Corner *corner,
 			 const MinMaxAll *min_max,
-			 PathEndVisitor *visitor);
+			 MakePathEnds *visitor);
   void makeGroupPathEnds(VertexSet *endpoints,
 			 const Corner *corner,
 			 const MinMaxAll *min_max,
-			 PathEndVisitor *visitor);
+			 MakePathEnds *visitor);
   void enumPathEnds(PathGroup *group,
 		    int group_count,
 		    int endpoint_count,
@@ -69,7 +69,7 @@ public:
   virtual Arrival arrival(const StaState *sta) const;
   virtual void setArrival(Arrival arrival,
 			  const StaState *sta);
-  virtual const Required &required(const StaState *sta) const;
+  virtual Required required(const StaState *sta) const;
   virtual void setRequired(const Required &required,
 			   const StaState *sta);
   virtual void prevPath(const StaState *sta,
@@ -0,0 +1,71 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2022, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "ObjectId.hh"
+#include "NetworkClass.hh"
+
+namespace sta {
+
+// Map from pins to VALUE pointers indexed by the pin Network::id.
+// Lookups index a vector instead of hashing or comparing pointers.
+// The vector only grows to the largest pin id in the map, so maps of
+// top level port pins, which have the first ids, stay small.
+// Pins are kept in insertion order for iteration.
+template <class VALUE>
+class PinIdMap
+{
+public:
+  VALUE findKey(ObjectId pin_id) const
+  {
+    if (pin_id < values_.size())
+      return values_[pin_id];
+    else
+      return nullptr;
+  }
+  bool hasKey(ObjectId pin_id) const { return findKey(pin_id) != nullptr; }
+  void insert(const Pin *pin,
+	      ObjectId pin_id,
+	      VALUE value)
+  {
+    if (pin_id >= values_.size())
+      values_.resize(pin_id + 1, nullptr);
+    if (values_[pin_id] == nullptr)
+      pins_.push_back(pin);
+    values_[pin_id] = value;
+  }
+  const ConstPinSeq &pins() const { return pins_; }
+  bool empty() const { return pins_.empty(); }
+  size_t size() const { return pins_.size(); }
+  void clear()
+  {
+    values_.clear();
+    pins_.clear();
+  }
+  void deleteContentsClear()
+  {
+    for (VALUE value : values_)
+      delete value;
+    clear();
+  }
+
+private:
+  Vector<VALUE> values_;
+  ConstPinSeq pins_;
+};
+
+} // namespace
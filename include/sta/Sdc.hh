@@ -17,11 +17,13 @@
 #pragma once
 
 #include <mutex>
+#include <atomic>
 
 #include "StringUtil.hh"
 #include "StringSet.hh"
 #include "Map.hh"
 #include "UnorderedMap.hh"
+#include "PinIdMap.hh"
 #include "MinMax.hh"
 #include "StaState.hh"
 #include "NetworkClass.hh"
@@ -32,6 +34,7 @@
 #include "Clock.hh"
 #include "DataCheck.hh"
 #include "CycleAccting.hh"
+#include "PortExtCap.hh"
 
 namespace sta {
 
@@ -102,9 +105,11 @@ public:
 typedef Map<const char*,Clock*, CharPtrLess> ClockNameMap;
 typedef UnorderedMap<const Pin*, ClockSet*> ClockPinMap;
 typedef Set<InputDelay*> InputDelaySet;
-typedef Map<const Pin*,InputDelaySet*> InputDelaysPinMap;
+typedef UnorderedMap<const Pin*,InputDelaySet*> InputDelaysPinMap;
+typedef PinIdMap<InputDelaySet*> InputDelaysPinIdMap;
 typedef Set<OutputDelay*> OutputDelaySet;
-typedef Map<const Pin*,OutputDelaySet*> OutputDelaysPinMap;
+typedef UnorderedMap<const Pin*,OutputDelaySet*> OutputDelaysPinMap;
+typedef PinIdMap<OutputDelaySet*> OutputDelaysPinIdMap;
 typedef Set<Instance*> InstanceSet;
 typedef UnorderedMap<const Pin*,ExceptionPathSet*> PinExceptionsMap;
 typedef Map<const Clock*,ExceptionPathSet*> ClockExceptionsMap;
@@ -113,8 +118,10 @@ typedef Map<const Net*,ExceptionPathSet*> NetExceptionsMap;
 typedef UnorderedMap<const EdgePins*,ExceptionPathSet*,
 		     PinPairHash, PinPairEqual> EdgeExceptionsMap;
 typedef Vector<ExceptionThru*> ExceptionThruSeq;
-typedef Map<const Port*,InputDrive*> InputDriveMap;
-typedef Map<int, ExceptionPathSet*, std::less<int> > ExceptionPathPtHash;
+// Indexed by the top level port pin id.
+typedef PinIdMap<InputDrive*> InputDriveMap;
+typedef Vector<InputDrive*> InputDriveSeq;
+typedef UnorderedMap<size_t, ExceptionPathSet*> ExceptionPathPtHash;
 typedef Set<ClockLatency*, ClockLatencyPinClkLess> ClockLatencies;
 typedef Map<const Pin*, ClockUncertainties*> PinClockUncertaintyMap;
 typedef Set<InterClockUncertainty*,
@@ -128,7 +135,9 @@ typedef Map<const Instance*, float> InstLatchBorrowLimitMap;
 typedef Map<const Clock*, float> ClockLatchBorrowLimitMap;
 typedef Set<DataCheck*, DataCheckLess> DataCheckSet;
 typedef Map<const Pin*, DataCheckSet*> DataChecksMap;
-typedef Map<Port*, PortExtCap*> PortExtCapMap;
+// Port external caps are stored in the map nodes to avoid a separate
+// allocation per port.
+typedef UnorderedMap<const Port*, PortExtCap> PortExtCapMap;
 typedef Map<Net*, MinMaxFloatValues> NetResistanceMap;
 typedef Map<Port*, MinMaxFloatValues> PortSlewLimitMap;
 typedef Map<const Pin*, MinMaxFloatValues> PinSlewLimitMap;
@@ -810,6 +819,7 @@ public:
 	      const MinMaxAll *min_max,
 	      Pvt *pvt);
   InputDrive *findInputDrive(Port *port);
+  InputDrive *findInputDrive(const Pin *port_pin);
   // True if pin is defined as a clock source (pin may be hierarchical).
   bool isClock(const Pin *pin) const;
   // True if pin is a clock source vertex.
@@ -868,8 +878,8 @@ public:
   void reportClkToClkMaxCycleWarnings();
 
   const InputDelaySet &inputDelays() const { return input_delays_; }
-  // Pin -> input delays.
-  const InputDelaysPinMap &inputDelayPinMap() const { return input_delay_pin_map_; }
+  // Pins with input delays.
+  const ConstPinSeq &inputDelayPins() const { return input_delay_pin_map_.pins(); }
   // Input delays on leaf_pin.
   InputDelaySet *inputDelaysLeafPin(const Pin *leaf_pin);
   bool hasInputDelay(const Pin *leaf_pin) const;
@@ -877,8 +887,8 @@ public:
   bool isInputDelayInternal(const Pin *pin) const;
 
   const OutputDelaySet &outputDelays() const { return output_delays_; }
-  // Pin -> output delays.
-  const OutputDelaysPinMap &outputDelayPinMap() const { return output_delay_pin_map_; }
+  // Pins with output delays.
+  const ConstPinSeq &outputDelayPins() const { return output_delay_pin_map_.pins(); }
   // Output delays on leaf_pin.
   OutputDelaySet *outputDelaysLeafPin(const Pin *leaf_pin);
   bool hasOutputDelay(const Pin *leaf_pin) const;
@@ -950,6 +960,11 @@ public:
                                          const Pin *to_pin,
                                          const RiseFall *to_rf,
                                          const MinMax *min_max) const;
+  // Return false if no exception -thru can match the edge from_pin ->
+  // to_pin, so exception states do not have to be checked against it.
+  // The table of -thru pins/instances/nets/edges is built on demand.
+  bool isExceptionThruEdge(const Pin *from_pin,
+			   const Pin *to_pin);
   // Find the highest priority exception with first exception pt at
   // pin/clk end.
   void exceptionTo(ExceptionPathType type,
@@ -1016,7 +1031,9 @@ protected:
   virtual void deletePinClocks(Clock *defining_clk,
 			       PinSet *pins);
   void makeDefaultArrivalClock();
-  InputDrive *ensureInputDrive(Port *port);
+  void ensureInputDrives(Port *port,
+			 // Return value.
+			 InputDriveSeq &drives);
   PortExtCap *ensurePortExtPinCap(Port *port);
   ExceptionPath *findMergeMatch(ExceptionPath *exception);
   void addException1(ExceptionPath *exception);
@@ -1032,6 +1049,8 @@ protected:
   void findMatchingExceptions(ExceptionPath *exception,
 			      ExceptionPathSet &matches);
   void checkForThruHpins(ExceptionPath *exception);
+  void exceptionThrusInvalid();
+  void findExceptionThrus();
   void findMatchingExceptionsFirstFrom(ExceptionPath *exception,
 				       ExceptionPathSet &matches);
   void findMatchingExceptionsFirstThru(ExceptionPath *exception,
@@ -1058,6 +1077,8 @@ protected:
 				ExceptionPathSet &expanded_matches);
   void recordException1(ExceptionPath *exception);
   void recordExceptionFirstPts(ExceptionPath *exception);
+  void recordMergedFirstPt(ExceptionPath *exception,
+			   ExceptionPt *merged_pt);
   void recordExceptionFirstFrom(ExceptionPath *exception);
   void recordExceptionFirstThru(ExceptionPath *exception);
   void recordExceptionFirstTo(ExceptionPath *exception);
@@ -1289,17 +1310,19 @@ protected:
   DataChecksMap data_checks_to_map_;
 
   InputDelaySet input_delays_;
-  InputDelaysPinMap input_delay_pin_map_;
+  InputDelaysPinIdMap input_delay_pin_map_;
   int input_delay_index_;
   InputDelaysPinMap input_delay_ref_pin_map_;
   // Input delays on hierarchical pins are indexed by the load pins.
+  // Hashed because the load pins can have any pin id.
   InputDelaysPinMap input_delay_leaf_pin_map_;
   InputDelaysPinMap input_delay_internal_pin_map_;
 
   OutputDelaySet output_delays_;
-  OutputDelaysPinMap output_delay_pin_map_;
+  OutputDelaysPinIdMap output_delay_pin_map_;
   OutputDelaysPinMap output_delay_ref_pin_map_;
   // Output delays on hierarchical pins are indexed by the load pins.
+  // Hashed because the load pins can have any pin id.
   OutputDelaysPinMap output_delay_leaf_pin_map_;
 
   PortSlewLimitMap port_slew_limit_map_;
@@ -1346,6 +1369,13 @@ protected:
   InstanceExceptionsMap *first_to_inst_exceptions_;
   // Edges that traverse hierarchical exception pins.
   EdgeExceptionsMap *first_thru_edge_exceptions_;
+  // Pins/instances/nets/edges of all exception -thru points.
+  PinSet exception_thru_pins_;
+  InstanceSet exception_thru_insts_;
+  NetSet exception_thru_nets_;
+  EdgePinsSet exception_thru_edges_;
+  std::atomic<bool> exception_thrus_valid_;
+  std::mutex exception_thrus_lock_;
 
   // Exception hash with one missing from/thru/to point, used for merging.
   ExceptionPathPtHash exception_merge_hash_;
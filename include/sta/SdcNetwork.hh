@@ -17,7 +17,11 @@
 #pragma once
 
 #include <functional>
+#include <mutex>
+#include <string>
 
+#include "UnorderedMap.hh"
+#include "StringSeq.hh"
 #include "Network.hh"
 
 namespace sta {
@@ -82,6 +86,7 @@ public:
   virtual Cell *cell(const Instance *instance) const;
   virtual Instance *parent(const Instance *instance) const;
   virtual bool isLeaf(const Instance *instance) const;
+  virtual ObjectId id(const Instance *instance) const;
   virtual Pin *findPin(const Instance *instance,
 		       const Port *port) const;
   virtual Pin *findPin(const Instance *instance,
@@ -99,6 +104,7 @@ public:
   virtual Net *net(const Pin *pin) const;
   virtual Term *term(const Pin *pin) const;
   virtual PortDirection *direction(const Pin *pin) const;
+  virtual ObjectId id(const Pin *pin) const;
   virtual VertexId vertexId(const Pin *pin) const;
   virtual void setVertexId(Pin *pin,
 			   VertexId id);
@@ -112,6 +118,7 @@ public:
   virtual Pin *pin(const Term *term) const;
 
   virtual Instance *instance(const Net *net) const;
+  virtual ObjectId id(const Net *net) const;
   virtual bool isPower(const Net *net) const;
   virtual bool isGround(const Net *net) const;
   virtual NetPinIterator *pinIterator(const Net *net) const;
@@ -167,6 +174,8 @@ protected:
 
 ////////////////////////////////////////////////////////////////
 
+typedef std::pair<Instance*, size_t> SdcPathPrefix;
+
 // Encapsulate a network to map names to/from the sdc namespace.
 class SdcNetwork : public NetworkNameAdapter
 {
@@ -215,6 +224,25 @@ public:
 				 Instance *parent);
   virtual Net *makeNet(const char *name,
 		       Instance *parent);
+  virtual void deleteInstance(Instance *inst);
+
+  // Find the pins for a list of path names from the top instance.
+  // Instance path prefixes shared by the names are resolved once.
+  // Names with wildcards, top level port names and names that are
+  // not found have a nullptr pin so the caller can match them.
+  // Returns false without finding any pins when an instance name
+  // includes a divider, because a path name can then match more than
+  // one pin.
+  bool findPins(const StringSeq &path_names,
+		// Return value.
+		PinSeq &pins) const;
+  // Find the instances for a list of path names like findPins.
+  bool findInstances(const StringSeq &path_names,
+		     // Return value.
+		     InstanceSeq &insts) const;
+  // Forget the instance path prefixes resolved by findPin/findNet/
+  // findInstance. Called when hierarchical instances are made or deleted.
+  void clearPathCache();
 
   // The following member functions are inherited from the
   // Network class work as is:
@@ -232,7 +260,9 @@ protected:
 		// Return values.
 		// Unescaped divider count.
 		int &divider_count,
-		int &path_length) const;
+		int &path_length,
+		// Offset of the last unescaped divider.
+		int &last_divider) const;
   void parsePath(const char *path,
 		 int divider_count,
 		 int path_length,
@@ -249,6 +279,18 @@ protected:
 		    PinSeq *pins) const;
 
   const char *staToSdc(const char *sta_name) const;
+  bool hasDividerInstanceNames() const;
+  bool hasDividerInstanceNames(const Instance *parent) const;
+
+  // Instance path prefix (up to the last unescaped divider) to the
+  // instance parsePath found for it and the offset of the path tail.
+  mutable UnorderedMap<std::string, SdcPathPrefix> path_cache_;
+  mutable const Instance *path_cache_top_;
+  // Some instance name includes an escaped divider, so a path name
+  // can have more than one instance path interpretation.
+  // -1 when it has not been checked.
+  mutable int divider_inst_names_;
+  mutable std::mutex path_cache_lock_;
 };
 
 // Encapsulate a network to map names to/from the sdc namespace.
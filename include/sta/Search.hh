@@ -17,9 +17,11 @@
 #pragma once
 
 #include <mutex>
+#include <atomic>
 
 #include "MinMax.hh"
 #include "UnorderedSet.hh"
+#include "UnorderedMap.hh"
 #include "Transition.hh"
 #include "LibertyClass.hh"
 #include "NetworkClass.hh"
@@ -60,6 +62,7 @@ typedef UnorderedSet<TagGroup*, TagGroupHash, TagGroupEqual> TagGroupSet;
 typedef Map<Vertex*, Slack> VertexSlackMap;
 typedef Vector<VertexSlackMap> VertexSlackMapSeq;
 typedef Vector<WorstSlacks> WorstSlacksSeq;
+typedef UnorderedMap<const ExceptionPt*, Level> ExceptionPtLevelMap;
 
 class Search : public StaState
 {
@@ -78,6 +81,23 @@ public:
   // disables additional search to returns approximate required times.
   bool crprApproxMissingRequireds() const;
   void setCrprApproxMissingRequireds(bool enabled);
+  // Arrival change (seconds) that causes fanout arrivals to be
+  // recomputed during incremental search. Defaults to 0.0 to
+  // propagate any change that fuzzyEqual can distinguish.
+  float arrivalTolerance() const { return arrival_tolerance_; }
+  void setArrivalTolerance(float tol);
+  // Vertices visited by arrival/required searches since the counts
+  // were cleared.
+  int arrivalVisitCount() const { return arrival_visit_count_; }
+  int requiredVisitCount() const { return required_visit_count_; }
+  void clearVisitCounts();
+  // When enabled, exception states that cannot match any downstream
+  // -thru/-to pin are removed from tags so paths that only differ by
+  // those states share tags and arrivals.
+  bool pruneExceptionStates() const { return prune_exception_states_; }
+  void setPruneExceptionStates(bool prune);
+  // Exception states removed from tags since the arrivals were found.
+  size_t prunedExceptionStateCount() const;
 
   bool unconstrainedPaths() const { return unconstrained_paths_; }
   // from/thrus/to are owned and deleted by Search.
@@ -105,6 +125,7 @@ public:
 			   bool clk_gating_hold);
   bool arrivalsValid();
   // Invalidate all arrival and required times.
+  // Deferred between deferInvalidBegin/deferInvalidEnd.
   void arrivalsInvalid();
   // Invalidate vertex arrival time.
   void arrivalInvalid(Vertex *vertex);
@@ -116,6 +137,14 @@ public:
   void requiredInvalid(Vertex *vertex);
   void requiredInvalid(Instance *inst);
   void requiredInvalid(const Pin *pin);
+  // Defer arrivalsInvalid() while a batch of constraints is applied.
+  // Vertex invalidations are recorded incrementally until an
+  // arrivalsInvalid() is deferred and ignored after that.
+  // A deferred arrivalsInvalid() is applied once when the last batch
+  // ends or before the next search.
+  void deferInvalidBegin();
+  void deferInvalidEnd();
+  void deferredInvalidFlush();
   // Vertex will be deleted.
   void deleteVertexBefore(Vertex *vertex);
   // Find all arrival times (propatating thru latches).
@@ -169,6 +198,11 @@ public:
   FilterPath *filter() const { return filter_; }
   void deleteFilter();
   void deleteFilteredArrivals();
+  // True if the filtered arrivals from the last search can be reused
+  // for a search with from/thrus/unconstrained.
+  bool filteredArrivalsReusable(ExceptionFrom *from,
+				ExceptionThruSeq *thrus,
+				bool unconstrained);
 
   // Endpoints are discovered during arrival search, so are only
   // defined after findArrivals.
@@ -261,6 +295,15 @@ public:
   void tnsInvalid(Vertex *vertex);
   bool arrivalsChanged(Vertex *vertex,
 		       TagGroupBldr *tag_bldr);
+  bool arrivalChanged(const Arrival &arrival1,
+		      const Arrival &arrival2,
+		      float tolerance) const;
+  void findExceptionPtLevels();
+  Level exceptionPtLevel(ExceptionPt *pt) const;
+  bool isDeadState(ExceptionState *state,
+		   Level to_level) const;
+  Level pinLevel(const Pin *pin,
+		 const MinMax *min_max) const;
   BfsFwdIterator *arrivalIterator() const { return arrival_iter_; }
   BfsBkwdIterator *requiredIterator() const { return required_iter_; }
   bool arrivalsAtEndpointsExist()const{return arrivals_at_endpoints_exist_;}
@@ -358,6 +401,7 @@ public:
 protected:
   void init(StaState *sta);
   void initVars();
+  void arrivalsInvalid1();
   void makeAnalysisPts(AnalysisType analysis_type);
   void makeAnalysisPts(bool swap_clk_min_max,
 		       bool report_min,
@@ -536,6 +580,17 @@ protected:
   bool unconstrained_paths_;
   bool crpr_path_pruning_enabled_;
   bool crpr_approx_missing_requireds_;
+  float arrival_tolerance_;
+  int arrival_visit_count_;
+  int required_visit_count_;
+  bool prune_exception_states_;
+  // Max vertex level of exception -thru/-to pins used to prune states.
+  ExceptionPtLevelMap exception_pt_levels_;
+  bool exception_pt_levels_valid_;
+  std::atomic<size_t> pruned_exception_state_count_;
+  // Nesting depth of deferInvalidBegin.
+  int invalid_defer_count_;
+  std::atomic<bool> invalid_deferred_;
   // Search predicates.
   SearchPred *search_adj_;
   SearchPred *search_clk_;
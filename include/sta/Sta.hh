@@ -120,6 +120,12 @@ public:
   bool linkDesign(const char *top_cell_name);
   bool linkMakeBlackBoxes() const;
   void setLinkMakeBlackBoxes(bool make);
+  // Write the linked network to a binary snapshot file.
+  void writeDesignSnapshot(const char *filename);
+  // Read a linked network from a snapshot file written by
+  // writeDesignSnapshot. Liberty libraries must be read first.
+  // Return true if successful.
+  bool readDesignSnapshot(const char *filename);
 
   // SDC Swig API.
   Instance *currentInstance() const;
@@ -790,6 +796,11 @@ public:
   // TCL variable sta_crpr_mode.
   CrprMode crprMode() const;
   void setCrprMode(CrprMode mode);
+  // TCL variable sta_prune_exception_states.
+  // Remove exception states that cannot match downstream -thru/-to
+  // pins from tags to reduce the number of tags and arrivals.
+  bool pruneExceptionStates() const;
+  void setPruneExceptionStates(bool prune);
   // TCL variable sta_pocv_enabled.
   // Parametric on chip variation (statisical sta).
   bool pocvEnabled() const;
@@ -948,7 +959,9 @@ public:
 		bool native,
 		int digits,
                 bool gzip,
-		bool no_timestamp);
+		bool no_timestamp,
+		// Write pins that are all of the bits of a bus as bus[*].
+		bool collapse_buses);
   // The sum of all negative endpoints slacks.
   // Incrementally updated.
   Slack totalNegativeSlack(const MinMax *min_max);
@@ -987,6 +1000,13 @@ public:
   PathRef vertexWorstSlackPath(Vertex *vertex,
                                const RiseFall *rf,
                                const MinMax *min_max);
+  // Worst slack path through each pin using one arrival/required
+  // search for all of the pins.
+  // Pins without paths have a null path.
+  void worstSlackPaths(const PinSeq &pins,
+                       const MinMax *min_max,
+                       // Return values.
+                       PathRefSeq &paths);
 
   // Find the min clock period for rise/rise and fall/fall paths of a clock
   // using the slack. This does NOT correctly predict min period when there
@@ -1174,6 +1194,15 @@ public:
   virtual void disconnectPin(Pin *pin);
   // Notify STA of network change.
   void networkChanged();
+  // Batch network edits (ECO). Between beginEco and commitEco the
+  // delay/arrival/required/level invalidation of connected pin fanin
+  // and fanout and of deleted graph edges is recorded and applied once
+  // per vertex by commitEco. Parasitics, sdc, sim and clock network
+  // updates still run per edit because they need the network before
+  // the edit. Timing queries made before commitEco commit the edits first.
+  void beginEco();
+  void commitEco();
+  bool inEco() const { return eco_active_; }
   void deleteLeafInstanceBefore(Instance *inst);
   void deleteInstancePinsBefore(Instance *inst);
 
@@ -1229,8 +1258,20 @@ public:
   // delays to be recomputed during incremental delay calculation.
   // Defaults to 0.0 for maximum accuracy and slowest incremental speed.
   void setIncrementalDelayTolerance(float tol);
+  // Arrival change (seconds) that causes fanout arrivals to be
+  // recomputed during incremental search.
+  // Defaults to 0.0 for maximum accuracy and slowest incremental speed.
+  void setIncrementalArrivalTolerance(float tol);
+  // Defer arrival/required invalidation by constraint changes until
+  // the batch ends so a large constraint file invalidates the search
+  // once instead of once per command. Batches nest.
+  void sdcBatchBegin();
+  void sdcBatchEnd();
   // Make graph and find delays.
   void searchPreamble();
+  // keep_filtered_arrivals leaves the filtered arrivals from the
+  // last report for the caller to reuse or delete.
+  void searchPreamble(bool keep_filtered_arrivals);
 
   // Define the delay calculator implementation.
   void setArcDelayCalc(const char *delay_calc_name);
@@ -1336,6 +1377,7 @@ protected:
 		     const ClockEdge *clk_edge,
 		     const PathAnalysisPt *path_ap);
   void findRequired(Vertex *vertex);
+  void findPrunedRequireds(const PinSeq &pins);
   Required vertexRequired(Vertex *vertex,
                           const RiseFall *rf,
                           const ClockEdge *clk_edge,
@@ -1343,6 +1385,11 @@ protected:
                           const MinMax *min_max);
   void connectDrvrPinAfter(Vertex *vertex);
   void connectLoadPinAfter(Vertex *vertex);
+  void deleteEdgeFromInvalid(Vertex *from);
+  void deleteEdgeToInvalid(Vertex *to);
+  void ecoDeleteVertexBefore(Vertex *vertex);
+  void clearEco();
+  void clearSdcPathCache();
   Path *latchEnablePath(Path *q_path,
 			Edge *d_q_edge,
 			const ClockEdge *en_clk_edge);
@@ -1419,6 +1466,14 @@ protected:
   bool graph_sdc_annotated_;
   bool parasitics_per_corner_;
   bool parasitics_per_min_max_;
+  bool eco_active_;
+  // Vertices with pending invalidation from edits between beginEco/commitEco.
+  VertexSet *eco_drvr_vertices_;
+  VertexSet *eco_load_vertices_;
+  VertexSet *eco_fanin_vertices_;
+  // From/to vertices of graph edges deleted by disconnects.
+  VertexSet *eco_edge_from_vertices_;
+  VertexSet *eco_edge_to_vertices_;
 
   // Singleton sta used by tcl command interpreter.
   static Sta *sta_;
@@ -94,6 +94,7 @@ public:
   ClkNetwork *clkNetwork() { return clk_network_; }
   ClkNetwork *clkNetwork() const { return clk_network_; }
   unsigned threadCount() const { return thread_count_; }
+  DispatchQueue *dispatchQueue() const { return dispatch_queue_; }
   bool pocvEnabled() const { return pocv_enabled_; }
   float sigmaFactor() const { return sigma_factor_; }
 
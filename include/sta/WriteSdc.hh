@@ -34,6 +34,8 @@ writeSdc(Instance *instance,
 	 int digits,
          bool gzip,
 	 bool no_timestamp,
+	 // Write pins that are all of the bits of a bus as bus[*].
+	 bool collapse_buses,
 	 Sdc *sdc);
 
 } // namespace
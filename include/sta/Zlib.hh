@@ -34,6 +34,9 @@
 #define gzclose fclose
 #define gzgets(stream,s,size) fgets(s,size,stream)
 #define gzprintf fprintf
+#define gzvprintf vfprintf
+#define gzwrite(stream,buf,len) fwrite(buf,1,len,stream)
+#define gzbuffer(stream,size) setvbuf(stream,nullptr,_IOFBF,size)
 #define Z_NULL nullptr
 
 #endif // ZLIB_FOUND
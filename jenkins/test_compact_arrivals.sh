@@ -0,0 +1,8 @@
+#!/bin/bash
+# Rebuild with 16 bit arrival storage and check that the arrivals match
+# full precision. The build writes app/sta, so run it after test.sh.
+set -x
+set -e
+cmake -B build_compact_arrivals -DCOMPACT_ARRIVALS=1 .
+cmake --build build_compact_arrivals -j 8
+docker run -u $(id -u ${USER}):$(id -g ${USER}) -v $(pwd):/OpenSTA openroad/opensta bash -c "/OpenSTA/test/regression compact_arrivals"
@@ -246,7 +246,10 @@ ConcreteNetTermIterator::next()
 ConcreteNetwork::ConcreteNetwork() :
   NetworkReader(),
   top_instance_(nullptr),
-  link_func_(nullptr)
+  link_func_(nullptr),
+  instance_id_count_(0),
+  pin_id_count_(0),
+  net_id_count_(0)
 {
 }
 
@@ -897,6 +900,14 @@ ConcreteNetwork::parent(const Instance *instance) const
   return reinterpret_cast<Instance*>(inst->parent());
 }
 
+ObjectId
+ConcreteNetwork::id(const Instance *instance) const
+{
+  const ConcreteInstance *inst =
+    reinterpret_cast<const ConcreteInstance*>(instance);
+  return inst->id();
+}
+
 bool
 ConcreteNetwork::isLeaf(const Instance *instance) const
 {
@@ -1018,6 +1029,13 @@ ConcreteNetwork::direction(const Pin *pin) const
   return cport->direction();
 }
 
+ObjectId
+ConcreteNetwork::id(const Pin *pin) const
+{
+  const ConcretePin *cpin = reinterpret_cast<const ConcretePin*>(pin);
+  return cpin->id();
+}
+
 VertexId
 ConcreteNetwork::vertexId(const Pin *pin) const
 {
@@ -1065,6 +1083,13 @@ ConcreteNetwork::instance(const Net *net) const
   return reinterpret_cast<Instance*>(cnet->instance());
 }
 
+ObjectId
+ConcreteNetwork::id(const Net *net) const
+{
+  const ConcreteNet *cnet = reinterpret_cast<const ConcreteNet*>(net);
+  return cnet->id();
+}
+
 bool
 ConcreteNetwork::isPower(const Net *net) const
 {
@@ -1140,7 +1165,8 @@ ConcreteNetwork::makeConcreteInstance(ConcreteCell *cell,
 {
   ConcreteInstance *cparent =
     reinterpret_cast<ConcreteInstance*>(parent);
-  ConcreteInstance *inst = new ConcreteInstance(cell, name, cparent);
+  ConcreteInstance *inst = new ConcreteInstance(cell, name, cparent,
+						++instance_id_count_);
   if (parent)
     cparent->addChild(inst);
   return reinterpret_cast<Instance*>(inst);
@@ -1236,7 +1262,7 @@ ConcreteNetwork::makePin(Instance *inst,
   ConcreteInstance *cinst = reinterpret_cast<ConcreteInstance*>(inst);
   ConcretePort *cport = reinterpret_cast<ConcretePort*>(port);
   ConcreteNet *cnet = reinterpret_cast<ConcreteNet*>(net);
-  ConcretePin *cpin = new ConcretePin(cinst, cport, cnet);
+  ConcretePin *cpin = new ConcretePin(cinst, cport, cnet, ++pin_id_count_);
   cinst->addPin(cpin);
   if (cnet)
     connectNetPin(cnet, cpin);
@@ -1279,7 +1305,7 @@ ConcreteNetwork::connect(Instance *inst,
       disconnectNetPin(prev_net, cpin);
   }
   else {
-    cpin = new ConcretePin(cinst, cport, cnet);
+    cpin = new ConcretePin(cinst, cport, cnet, ++pin_id_count_);
     cinst->addPin(cpin);
   }
   if (inst == top_instance_) {
@@ -1382,7 +1408,7 @@ ConcreteNetwork::makeNet(const char *name,
 			 Instance *parent)
 {
   ConcreteInstance *cparent = reinterpret_cast<ConcreteInstance*>(parent);
-  ConcreteNet *net = new ConcreteNet(name, cparent);
+  ConcreteNet *net = new ConcreteNet(name, cparent, ++net_id_count_);
   cparent->addNet(net);
   return reinterpret_cast<Net*>(net);
 }
@@ -1479,10 +1505,12 @@ ConcreteNetwork::visitConnectedPins(const Net *net,
 
 ConcreteInstance::ConcreteInstance(ConcreteCell *cell,
 				   const char *name,
-				   ConcreteInstance *parent) :
+				   ConcreteInstance *parent,
+				   ObjectId id) :
   cell_(cell),
   name_(stringCopy(name)),
   parent_(parent),
+  id_(id),
   children_(nullptr),
   nets_(nullptr)
 {
@@ -1649,13 +1677,15 @@ ConcreteInstance::setCell(ConcreteCell *cell)
 
 ConcretePin::ConcretePin(ConcreteInstance *instance,
 			 ConcretePort *port,
-			 ConcreteNet *net) :
+			 ConcreteNet *net,
+			 ObjectId id) :
   instance_(instance),
   port_(port),
   net_(net),
   term_(nullptr),
   net_next_(nullptr),
   net_prev_(nullptr),
+  id_(id),
   vertex_id_(vertex_id_null)
 {
 }
@@ -1694,9 +1724,11 @@ ConcreteTerm::ConcreteTerm(ConcretePin *pin,
 ////////////////////////////////////////////////////////////////
 
 ConcreteNet::ConcreteNet(const char *name,
-			 ConcreteInstance *instance) :
+			 ConcreteInstance *instance,
+			 ObjectId id) :
   name_(stringCopy(name)),
   instance_(instance),
+  id_(id),
   pins_(nullptr),
   terms_(nullptr),
   merged_into_(nullptr)
@@ -0,0 +1,979 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2022, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "NetworkSnapshot.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+#include <set>
+#include <unordered_map>
+
+#include "Error.hh"
+#include "StringUtil.hh"
+#include "Report.hh"
+#include "PortDirection.hh"
+#include "ConcreteLibrary.hh"
+#include "ConcreteNetwork.hh"
+
+namespace sta {
+
+using std::string;
+using std::vector;
+using std::set;
+using std::unordered_map;
+
+static const char snapshot_magic[8] = "STASNAP";
+static constexpr uint32_t snapshot_version = 1;
+// Written in native byte order to reject files from foreign endian hosts.
+static constexpr uint32_t snapshot_byte_order = 0x01020304;
+static constexpr uint32_t snapshot_null = ~0U;
+static constexpr size_t snapshot_align = 8;
+
+// All records are arrays of uint32_t so the in-memory layout is
+// identical to the file layout.
+
+struct SnapshotHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t string_bytes;
+  uint32_t library_count;
+  uint32_t cell_count;
+  uint32_t port_count;
+  uint32_t member_count;
+  uint32_t bit_count;
+  uint32_t instance_count;
+  uint32_t net_count;
+  uint32_t pin_count;
+  uint32_t reserved;
+};
+
+struct SnapshotLibrary
+{
+  uint32_t name;
+  uint32_t is_liberty;
+  uint32_t bus_brkt_left;
+  uint32_t bus_brkt_right;
+};
+
+struct SnapshotCell
+{
+  uint32_t library;
+  uint32_t name;
+  uint32_t is_leaf;
+  // Port definitions are only written for non-liberty cells.
+  uint32_t port_begin;
+  uint32_t port_count;
+  // Port bit names in pin index order.
+  uint32_t bit_begin;
+  uint32_t bit_count;
+  uint32_t reserved;
+};
+
+enum class SnapshotPortKind : uint32_t { scalar, bus, bundle };
+
+struct SnapshotPort
+{
+  uint32_t name;
+  uint32_t kind;
+  uint32_t from_index;
+  uint32_t to_index;
+  uint32_t direction;
+  // Bundle member port names.
+  uint32_t member_begin;
+  uint32_t member_count;
+  uint32_t reserved;
+};
+
+// Instances are in pre-order so parents precede their children.
+struct SnapshotInstance
+{
+  uint32_t parent;
+  uint32_t cell;
+  uint32_t name;
+  uint32_t pin_begin;
+  uint32_t pin_count;
+  uint32_t reserved;
+};
+
+struct SnapshotNet
+{
+  uint32_t instance;
+  uint32_t name;
+  // Surviving net for merged net name aliases.
+  uint32_t merged_into;
+  // LogicValue for power/ground nets.
+  uint32_t constant;
+};
+
+struct SnapshotPin
+{
+  // Index into the instance cell's port bits.
+  uint32_t bit;
+  uint32_t net;
+  uint32_t has_term;
+  uint32_t term_net;
+};
+
+static size_t
+alignedSize(size_t size)
+{
+  return (size + snapshot_align - 1) & ~(snapshot_align - 1);
+}
+
+////////////////////////////////////////////////////////////////
+
+class NetworkSnapshotWriter
+{
+public:
+  explicit NetworkSnapshotWriter(ConcreteNetwork *network);
+  void write(FILE *stream);
+
+protected:
+  uint32_t stringIndex(const char *str);
+  uint32_t libraryIndex(ConcreteLibrary *library);
+  uint32_t cellIndex(ConcreteCell *cell);
+  void recordCellPorts(const ConcreteCell *cell,
+		       SnapshotCell &cell_rec);
+  void recordInstance(const ConcreteInstance *inst,
+		      uint32_t parent);
+  void recordNets(const ConcreteInstance *inst,
+		  uint32_t inst_index);
+  void recordPins(const ConcreteInstance *inst,
+		  SnapshotInstance &inst_rec);
+  uint32_t netIndex(const ConcreteNet *net) const;
+  template <class RECORD>
+  void writeSection(const vector<RECORD> &records,
+		    FILE *stream);
+  void writeBytes(const void *bytes,
+		  size_t size,
+		  FILE *stream);
+
+  ConcreteNetwork *network_;
+  vector<char> strings_;
+  unordered_map<string, uint32_t> string_map_;
+  vector<SnapshotLibrary> libraries_;
+  unordered_map<const ConcreteLibrary*, uint32_t> library_map_;
+  vector<SnapshotCell> cells_;
+  unordered_map<const ConcreteCell*, uint32_t> cell_map_;
+  vector<SnapshotPort> ports_;
+  vector<uint32_t> members_;
+  vector<uint32_t> bits_;
+  vector<SnapshotInstance> instances_;
+  vector<const ConcreteInstance*> instance_seq_;
+  vector<SnapshotNet> nets_;
+  // Surviving net of each net record.
+  vector<const ConcreteNet*> net_seq_;
+  unordered_map<const ConcreteNet*, uint32_t> net_map_;
+  vector<SnapshotPin> pins_;
+};
+
+void
+writeNetworkSnapshot(const char *filename,
+		     ConcreteNetwork *network)
+{
+  if (network->topInstance()) {
+    FILE *stream = fopen(filename, "wb");
+    if (stream) {
+      NetworkSnapshotWriter writer(network);
+      writer.write(stream);
+      fclose(stream);
+    }
+    else
+      throw FileNotWritable(filename);
+  }
+}
+
+NetworkSnapshotWriter::NetworkSnapshotWriter(ConcreteNetwork *network) :
+  network_(network)
+{
+}
+
+void
+NetworkSnapshotWriter::write(FILE *stream)
+{
+  const ConcreteInstance *top =
+    reinterpret_cast<const ConcreteInstance*>(network_->topInstance());
+  recordInstance(top, snapshot_null);
+  for (size_t i = 0; i < instance_seq_.size(); i++)
+    recordNets(instance_seq_[i], i);
+  // Resolve merged net aliases now that every surviving net has an index.
+  for (size_t i = 0; i < nets_.size(); i++) {
+    const ConcreteNet *net = net_seq_[i];
+    uint32_t net_index = netIndex(net);
+    if (net_index != i)
+      nets_[i].merged_into = net_index;
+  }
+  for (size_t i = 0; i < instance_seq_.size(); i++)
+    recordPins(instance_seq_[i], instances_[i]);
+
+  SnapshotHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+  header.version = snapshot_version;
+  header.byte_order = snapshot_byte_order;
+  header.string_bytes = strings_.size();
+  header.library_count = libraries_.size();
+  header.cell_count = cells_.size();
+  header.port_count = ports_.size();
+  header.member_count = members_.size();
+  header.bit_count = bits_.size();
+  header.instance_count = instances_.size();
+  header.net_count = nets_.size();
+  header.pin_count = pins_.size();
+  writeBytes(&header, sizeof(header), stream);
+  writeSection(strings_, stream);
+  writeSection(libraries_, stream);
+  writeSection(cells_, stream);
+  writeSection(ports_, stream);
+  writeSection(members_, stream);
+  writeSection(bits_, stream);
+  writeSection(instances_, stream);
+  writeSection(nets_, stream);
+  writeSection(pins_, stream);
+}
+
+template <class RECORD>
+void
+NetworkSnapshotWriter::writeSection(const vector<RECORD> &records,
+				    FILE *stream)
+{
+  size_t size = records.size() * sizeof(RECORD);
+  writeBytes(records.data(), size, stream);
+  static const char padding[snapshot_align] = {0};
+  writeBytes(padding, alignedSize(size) - size, stream);
+}
+
+void
+NetworkSnapshotWriter::writeBytes(const void *bytes,
+				  size_t size,
+				  FILE *stream)
+{
+  if (size > 0)
+    fwrite(bytes, 1, size, stream);
+}
+
+uint32_t
+NetworkSnapshotWriter::stringIndex(const char *str)
+{
+  if (str == nullptr)
+    return snapshot_null;
+  auto itr = string_map_.find(str);
+  if (itr == string_map_.end()) {
+    uint32_t index = strings_.size();
+    strings_.insert(strings_.end(), str, str + strlen(str) + 1);
+    string_map_[str] = index;
+    return index;
+  }
+  else
+    return itr->second;
+}
+
+uint32_t
+NetworkSnapshotWriter::libraryIndex(ConcreteLibrary *library)
+{
+  auto itr = library_map_.find(library);
+  if (itr == library_map_.end()) {
+    uint32_t index = libraries_.size();
+    SnapshotLibrary lib_rec;
+    lib_rec.name = stringIndex(library->name());
+    lib_rec.is_liberty = library->isLiberty();
+    lib_rec.bus_brkt_left = library->busBrktLeft();
+    lib_rec.bus_brkt_right = library->busBrktRight();
+    libraries_.push_back(lib_rec);
+    library_map_[library] = index;
+    return index;
+  }
+  else
+    return itr->second;
+}
+
+uint32_t
+NetworkSnapshotWriter::cellIndex(ConcreteCell *cell)
+{
+  auto itr = cell_map_.find(cell);
+  if (itr == cell_map_.end()) {
+    ConcreteLibrary *library = cell->library();
+    SnapshotCell cell_rec;
+    memset(&cell_rec, 0, sizeof(cell_rec));
+    cell_rec.library = libraryIndex(library);
+    cell_rec.name = stringIndex(cell->name());
+    cell_rec.is_leaf = cell->isLeaf();
+    cell_rec.port_begin = ports_.size();
+    if (!library->isLiberty())
+      recordCellPorts(cell, cell_rec);
+    cell_rec.port_count = ports_.size() - cell_rec.port_begin;
+
+    cell_rec.bit_begin = bits_.size();
+    cell_rec.bit_count = cell->portBitCount();
+    bits_.resize(bits_.size() + cell_rec.bit_count, snapshot_null);
+    ConcreteCellPortBitIterator *bit_iter = cell->portBitIterator();
+    while (bit_iter->hasNext()) {
+      ConcretePort *bit = bit_iter->next();
+      bits_[cell_rec.bit_begin + bit->pinIndex()] = stringIndex(bit->name());
+    }
+    delete bit_iter;
+
+    uint32_t index = cells_.size();
+    cells_.push_back(cell_rec);
+    cell_map_[cell] = index;
+    return index;
+  }
+  else
+    return itr->second;
+}
+
+void
+NetworkSnapshotWriter::recordCellPorts(const ConcreteCell *cell,
+				       SnapshotCell &cell_rec)
+{
+  ConcreteCellPortIterator *port_iter = cell->portIterator();
+  while (port_iter->hasNext()) {
+    ConcretePort *port = port_iter->next();
+    SnapshotPort port_rec;
+    memset(&port_rec, 0, sizeof(port_rec));
+    port_rec.name = stringIndex(port->name());
+    port_rec.direction = port->direction()->index();
+    port_rec.member_begin = members_.size();
+    if (port->isBus()) {
+      port_rec.kind = uint32_t(SnapshotPortKind::bus);
+      port_rec.from_index = port->fromIndex();
+      port_rec.to_index = port->toIndex();
+    }
+    else if (port->isBundle()) {
+      port_rec.kind = uint32_t(SnapshotPortKind::bundle);
+      ConcretePortMemberIterator *member_iter = port->memberIterator();
+      while (member_iter->hasNext()) {
+	ConcretePort *member = member_iter->next();
+	members_.push_back(stringIndex(member->name()));
+      }
+      delete member_iter;
+    }
+    else
+      port_rec.kind = uint32_t(SnapshotPortKind::scalar);
+    port_rec.member_count = members_.size() - port_rec.member_begin;
+    ports_.push_back(port_rec);
+  }
+  delete port_iter;
+  cell_rec.port_count = ports_.size() - cell_rec.port_begin;
+}
+
+void
+NetworkSnapshotWriter::recordInstance(const ConcreteInstance *inst,
+				      uint32_t parent)
+{
+  ConcreteCell *cell = reinterpret_cast<ConcreteCell*>(inst->cell());
+  SnapshotInstance inst_rec;
+  memset(&inst_rec, 0, sizeof(inst_rec));
+  inst_rec.parent = parent;
+  inst_rec.cell = cellIndex(cell);
+  inst_rec.name = stringIndex(inst->name());
+  uint32_t index = instances_.size();
+  instances_.push_back(inst_rec);
+  instance_seq_.push_back(inst);
+  if (inst->children_) {
+    ConcreteInstanceChildMap::ConstIterator child_iter(inst->children_);
+    while (child_iter.hasNext()) {
+      const ConcreteInstance *child = child_iter.next();
+      recordInstance(child, index);
+    }
+  }
+}
+
+void
+NetworkSnapshotWriter::recordNets(const ConcreteInstance *inst,
+				  uint32_t inst_index)
+{
+  if (inst->nets_) {
+    ConcreteInstanceNetMap::ConstIterator net_iter(inst->nets_);
+    while (net_iter.hasNext()) {
+      const char *net_name;
+      ConcreteNet *net;
+      net_iter.next(net_name, net);
+      while (net->mergedInto())
+	net = net->mergedInto();
+      Net *net1 = reinterpret_cast<Net*>(net);
+      SnapshotNet net_rec;
+      net_rec.instance = inst_index;
+      net_rec.name = stringIndex(net_name);
+      net_rec.merged_into = snapshot_null;
+      if (network_->isGround(net1))
+	net_rec.constant = uint32_t(LogicValue::zero);
+      else if (network_->isPower(net1))
+	net_rec.constant = uint32_t(LogicValue::one);
+      else
+	net_rec.constant = uint32_t(LogicValue::unknown);
+      uint32_t index = nets_.size();
+      nets_.push_back(net_rec);
+      net_seq_.push_back(net);
+      // The first name entry for a net is the net itself; later
+      // entries are name aliases.
+      if (net_map_.find(net) == net_map_.end()
+	  && stringEq(net_name, net->name()))
+	net_map_[net] = index;
+    }
+  }
+}
+
+uint32_t
+NetworkSnapshotWriter::netIndex(const ConcreteNet *net) const
+{
+  if (net) {
+    auto itr = net_map_.find(net);
+    if (itr != net_map_.end())
+      return itr->second;
+  }
+  return snapshot_null;
+}
+
+void
+NetworkSnapshotWriter::recordPins(const ConcreteInstance *inst,
+				  SnapshotInstance &inst_rec)
+{
+  inst_rec.pin_begin = pins_.size();
+  const ConcreteCell *cell = reinterpret_cast<ConcreteCell*>(inst->cell());
+  int pin_count = cell->portBitCount();
+  for (int i = 0; i < pin_count; i++) {
+    const ConcretePin *pin = inst->pins_[i];
+    if (pin) {
+      SnapshotPin pin_rec;
+      pin_rec.bit = pin->port()->pinIndex();
+      pin_rec.net = netIndex(pin->net());
+      const ConcreteTerm *term = pin->term();
+      pin_rec.has_term = term != nullptr;
+      pin_rec.term_net = term ? netIndex(term->net()) : snapshot_null;
+      pins_.push_back(pin_rec);
+    }
+  }
+  inst_rec.pin_count = pins_.size() - inst_rec.pin_begin;
+}
+
+////////////////////////////////////////////////////////////////
+
+class NetworkSnapshotReader
+{
+public:
+  NetworkSnapshotReader(const char *filename,
+			ConcreteNetwork *network,
+			std::function<void ()> read_before);
+  bool read();
+
+protected:
+  void readFile();
+  void findSections();
+  template <class RECORD>
+  const RECORD *section(size_t count);
+  void checkRecords() const;
+  void checkIndex(uint32_t index,
+		  size_t count) const;
+  void checkRange(uint32_t begin,
+		  uint32_t count,
+		  size_t size) const;
+  void checkNullIndex(uint32_t index,
+		      size_t count) const;
+  const char *findString(uint32_t index) const;
+  void findCells();
+  Cell *findLibertyCell(const SnapshotCell &cell_rec);
+  Cell *findCell(const SnapshotCell &cell_rec);
+  Cell *makeCell(const SnapshotCell &cell_rec);
+  void makeCellPorts(Cell *cell,
+		     const SnapshotCell &cell_rec);
+  void findCellBits(Cell *cell,
+		    const SnapshotCell &cell_rec);
+  void checkCellBits(const SnapshotCell &cell_rec);
+  PortDirection *portDirection(uint32_t index) const;
+  Instance *makeNetwork();
+
+  const char *filename_;
+  ConcreteNetwork *network_;
+  std::function<void ()> read_before_;
+  vector<char> buffer_;
+  size_t offset_;
+  const SnapshotHeader *header_;
+  const char *strings_;
+  const SnapshotLibrary *libraries_;
+  const SnapshotCell *cells_;
+  const SnapshotPort *ports_;
+  const uint32_t *members_;
+  const uint32_t *bits_;
+  const SnapshotInstance *instances_;
+  const SnapshotNet *nets_;
+  const SnapshotPin *pins_;
+  vector<Cell*> cell_seq_;
+  // Port bits of every cell in snapshot bit order.
+  vector<Port*> bit_ports_;
+};
+
+bool
+readNetworkSnapshot(const char *filename,
+		    ConcreteNetwork *network,
+		    std::function<void ()> read_before)
+{
+  NetworkSnapshotReader reader(filename, network, read_before);
+  return reader.read();
+}
+
+NetworkSnapshotReader::NetworkSnapshotReader(const char *filename,
+					     ConcreteNetwork *network,
+					     std::function<void ()> read_before) :
+  filename_(filename),
+  network_(network),
+  read_before_(read_before),
+  offset_(0),
+  header_(nullptr),
+  strings_(nullptr),
+  libraries_(nullptr),
+  cells_(nullptr),
+  ports_(nullptr),
+  members_(nullptr),
+  bits_(nullptr),
+  instances_(nullptr),
+  nets_(nullptr),
+  pins_(nullptr)
+{
+}
+
+bool
+NetworkSnapshotReader::read()
+{
+  readFile();
+  findSections();
+  // Validate the records and resolve every cell and port before
+  // making libraries, cells or instances so errors do not leave a
+  // partial network or delete the current design.
+  checkRecords();
+  findCells();
+  if (read_before_)
+    read_before_();
+  Instance *top_inst = makeNetwork();
+  network_->setTopInstance(top_inst);
+  return top_inst != nullptr;
+}
+
+void
+NetworkSnapshotReader::readFile()
+{
+  FILE *stream = fopen(filename_, "rb");
+  if (stream == nullptr)
+    throw FileNotReadable(filename_);
+  fseek(stream, 0, SEEK_END);
+  long size = ftell(stream);
+  fseek(stream, 0, SEEK_SET);
+  if (size > 0) {
+    buffer_.resize(size);
+    size_t read_size = fread(buffer_.data(), 1, size, stream);
+    buffer_.resize(read_size);
+  }
+  fclose(stream);
+}
+
+void
+NetworkSnapshotReader::findSections()
+{
+  Report *report = network_->report();
+  header_ = section<SnapshotHeader>(1);
+  if (memcmp(header_->magic, snapshot_magic, sizeof(snapshot_magic)) != 0)
+    report->error(800, "%s is not a network snapshot file.", filename_);
+  if (header_->byte_order != snapshot_byte_order)
+    report->error(801, "%s network snapshot byte order is not supported.",
+		  filename_);
+  if (header_->version != snapshot_version)
+    report->error(802, "%s network snapshot version %u is not supported.",
+		  filename_,
+		  header_->version);
+  strings_ = section<char>(header_->string_bytes);
+  libraries_ = section<SnapshotLibrary>(header_->library_count);
+  cells_ = section<SnapshotCell>(header_->cell_count);
+  ports_ = section<SnapshotPort>(header_->port_count);
+  members_ = section<uint32_t>(header_->member_count);
+  bits_ = section<uint32_t>(header_->bit_count);
+  instances_ = section<SnapshotInstance>(header_->instance_count);
+  nets_ = section<SnapshotNet>(header_->net_count);
+  pins_ = section<SnapshotPin>(header_->pin_count);
+  if (offset_ != buffer_.size()
+      || header_->instance_count == 0
+      || header_->string_bytes == 0
+      || strings_[header_->string_bytes - 1] != '\0')
+    report->error(803, "%s network snapshot is corrupt.", filename_);
+}
+
+template <class RECORD>
+const RECORD *
+NetworkSnapshotReader::section(size_t count)
+{
+  size_t size = alignedSize(count * sizeof(RECORD));
+  if (offset_ + size > buffer_.size())
+    network_->report()->error(804, "%s network snapshot is truncated.",
+			      filename_);
+  const RECORD *records = reinterpret_cast<const RECORD*>(&buffer_[offset_]);
+  offset_ += size;
+  return records;
+}
+
+void
+NetworkSnapshotReader::checkRecords() const
+{
+  for (size_t i = 0; i < header_->library_count; i++)
+    checkIndex(libraries_[i].name, header_->string_bytes);
+  for (size_t i = 0; i < header_->cell_count; i++) {
+    const SnapshotCell &cell_rec = cells_[i];
+    checkIndex(cell_rec.library, header_->library_count);
+    checkIndex(cell_rec.name, header_->string_bytes);
+    checkRange(cell_rec.port_begin, cell_rec.port_count, header_->port_count);
+    checkRange(cell_rec.bit_begin, cell_rec.bit_count, header_->bit_count);
+  }
+  for (size_t i = 0; i < header_->port_count; i++) {
+    const SnapshotPort &port_rec = ports_[i];
+    checkIndex(port_rec.name, header_->string_bytes);
+    checkIndex(port_rec.kind, uint32_t(SnapshotPortKind::bundle) + 1);
+    checkRange(port_rec.member_begin, port_rec.member_count,
+	       header_->member_count);
+  }
+  for (size_t i = 0; i < header_->member_count; i++)
+    checkIndex(members_[i], header_->string_bytes);
+  for (size_t i = 0; i < header_->bit_count; i++)
+    checkNullIndex(bits_[i], header_->string_bytes);
+  for (size_t i = 0; i < header_->instance_count; i++) {
+    const SnapshotInstance &inst_rec = instances_[i];
+    // Parents precede their children and only the first instance is top.
+    if (i == 0) {
+      if (inst_rec.parent != snapshot_null)
+	network_->report()->error(809, "%s network snapshot is corrupt.",
+				  filename_);
+    }
+    else
+      checkIndex(inst_rec.parent, i);
+    checkIndex(inst_rec.cell, header_->cell_count);
+    checkIndex(inst_rec.name, header_->string_bytes);
+    checkRange(inst_rec.pin_begin, inst_rec.pin_count, header_->pin_count);
+    const SnapshotCell &cell_rec = cells_[inst_rec.cell];
+    for (size_t p = 0; p < inst_rec.pin_count; p++) {
+      const SnapshotPin &pin_rec = pins_[inst_rec.pin_begin + p];
+      checkIndex(pin_rec.bit, cell_rec.bit_count);
+      checkIndex(bits_[cell_rec.bit_begin + pin_rec.bit],
+		 header_->string_bytes);
+      checkNullIndex(pin_rec.net, header_->net_count);
+      checkNullIndex(pin_rec.term_net, header_->net_count);
+    }
+  }
+  for (size_t i = 0; i < header_->net_count; i++) {
+    const SnapshotNet &net_rec = nets_[i];
+    checkIndex(net_rec.instance, header_->instance_count);
+    checkIndex(net_rec.name, header_->string_bytes);
+    checkNullIndex(net_rec.merged_into, header_->net_count);
+  }
+}
+
+void
+NetworkSnapshotReader::checkIndex(uint32_t index,
+				  size_t count) const
+{
+  if (index >= count)
+    network_->report()->error(805, "%s network snapshot is corrupt.",
+			      filename_);
+}
+
+void
+NetworkSnapshotReader::checkNullIndex(uint32_t index,
+				      size_t count) const
+{
+  if (index != snapshot_null)
+    checkIndex(index, count);
+}
+
+void
+NetworkSnapshotReader::checkRange(uint32_t begin,
+				  uint32_t count,
+				  size_t size) const
+{
+  if (size_t(begin) + count > size)
+    network_->report()->error(806, "%s network snapshot is corrupt.",
+			      filename_);
+}
+
+const char *
+NetworkSnapshotReader::findString(uint32_t index) const
+{
+  if (index == snapshot_null)
+    return nullptr;
+  else
+    return &strings_[index];
+}
+
+void
+NetworkSnapshotReader::findCells()
+{
+  cell_seq_.resize(header_->cell_count, nullptr);
+  bit_ports_.resize(header_->bit_count, nullptr);
+  // Resolve every cell and port bit before making anything so a
+  // missing liberty cell or port does not leave partial libraries.
+  for (size_t i = 0; i < header_->cell_count; i++) {
+    const SnapshotCell &cell_rec = cells_[i];
+    const SnapshotLibrary &lib_rec = libraries_[cell_rec.library];
+    Cell *cell = lib_rec.is_liberty
+      ? findLibertyCell(cell_rec)
+      : findCell(cell_rec);
+    cell_seq_[i] = cell;
+    if (cell)
+      findCellBits(cell, cell_rec);
+    else
+      checkCellBits(cell_rec);
+  }
+  for (size_t i = 0; i < header_->cell_count; i++) {
+    if (cell_seq_[i] == nullptr) {
+      const SnapshotCell &cell_rec = cells_[i];
+      Cell *cell = makeCell(cell_rec);
+      cell_seq_[i] = cell;
+      findCellBits(cell, cell_rec);
+    }
+  }
+}
+
+Cell *
+NetworkSnapshotReader::findLibertyCell(const SnapshotCell &cell_rec)
+{
+  const SnapshotLibrary &lib_rec = libraries_[cell_rec.library];
+  const char *lib_name = findString(lib_rec.name);
+  const char *cell_name = findString(cell_rec.name);
+  Cell *cell = nullptr;
+  Library *library = network_->findLibrary(lib_name);
+  if (library)
+    cell = network_->findCell(library, cell_name);
+  if (cell == nullptr)
+    // Fall back to the link path search order.
+    cell = network_->findAnyCell(cell_name);
+  if (cell == nullptr)
+    network_->report()->error(807, "%s liberty cell %s/%s not found.",
+			      filename_,
+			      lib_name,
+			      cell_name);
+  return cell;
+}
+
+// Reuse cells from a previously read netlist with the same name.
+Cell *
+NetworkSnapshotReader::findCell(const SnapshotCell &cell_rec)
+{
+  const SnapshotLibrary &lib_rec = libraries_[cell_rec.library];
+  Library *library = network_->findLibrary(findString(lib_rec.name));
+  if (library)
+    return network_->findCell(library, findString(cell_rec.name));
+  else
+    return nullptr;
+}
+
+Cell *
+NetworkSnapshotReader::makeCell(const SnapshotCell &cell_rec)
+{
+  const SnapshotLibrary &lib_rec = libraries_[cell_rec.library];
+  const char *lib_name = findString(lib_rec.name);
+  const char *cell_name = findString(cell_rec.name);
+  Library *library = network_->findLibrary(lib_name);
+  if (library == nullptr) {
+    library = network_->makeLibrary(lib_name, nullptr);
+    ConcreteLibrary *clib = reinterpret_cast<ConcreteLibrary*>(library);
+    clib->setBusBrkts(lib_rec.bus_brkt_left, lib_rec.bus_brkt_right);
+  }
+  Cell *cell = network_->makeCell(library, cell_name, cell_rec.is_leaf,
+				  nullptr);
+  makeCellPorts(cell, cell_rec);
+  return cell;
+}
+
+void
+NetworkSnapshotReader::makeCellPorts(Cell *cell,
+				     const SnapshotCell &cell_rec)
+{
+  for (size_t i = 0; i < cell_rec.port_count; i++) {
+    const SnapshotPort &port_rec = ports_[cell_rec.port_begin + i];
+    const char *port_name = findString(port_rec.name);
+    PortDirection *dir = portDirection(port_rec.direction);
+    switch (SnapshotPortKind(port_rec.kind)) {
+    case SnapshotPortKind::scalar: {
+      Port *port = network_->makePort(cell, port_name);
+      network_->setDirection(port, dir);
+      break;
+    }
+    case SnapshotPortKind::bus: {
+      Port *port = network_->makeBusPort(cell, port_name,
+					 int(port_rec.from_index),
+					 int(port_rec.to_index));
+      network_->setDirection(port, dir);
+      break;
+    }
+    case SnapshotPortKind::bundle: {
+      PortSeq *members = new PortSeq;
+      for (size_t m = 0; m < port_rec.member_count; m++) {
+	uint32_t member_name = members_[port_rec.member_begin + m];
+	Port *member = network_->findPort(cell, findString(member_name));
+	if (member)
+	  members->push_back(member);
+      }
+      // Bundle members carry their own directions.
+      network_->makeBundlePort(cell, port_name, members);
+      break;
+    }
+    }
+  }
+}
+
+PortDirection *
+NetworkSnapshotReader::portDirection(uint32_t index) const
+{
+  PortDirection *dirs[] = {PortDirection::input(),
+			   PortDirection::output(),
+			   PortDirection::tristate(),
+			   PortDirection::bidirect(),
+			   PortDirection::internal(),
+			   PortDirection::ground(),
+			   PortDirection::power(),
+			   PortDirection::unknown()};
+  for (PortDirection *dir : dirs) {
+    if (uint32_t(dir->index()) == index)
+      return dir;
+  }
+  return PortDirection::unknown();
+}
+
+void
+NetworkSnapshotReader::findCellBits(Cell *cell,
+				    const SnapshotCell &cell_rec)
+{
+  for (size_t i = 0; i < cell_rec.bit_count; i++) {
+    uint32_t bit_index = cell_rec.bit_begin + i;
+    const char *bit_name = findString(bits_[bit_index]);
+    if (bit_name) {
+      Port *port = network_->findPort(cell, bit_name);
+      if (port == nullptr)
+	network_->report()->error(808, "%s cell %s port %s not found.",
+				  filename_,
+				  network_->name(cell),
+				  bit_name);
+      bit_ports_[bit_index] = port;
+    }
+  }
+}
+
+// Check that the port records of a cell that will be made
+// define every port bit name the pins refer to.
+void
+NetworkSnapshotReader::checkCellBits(const SnapshotCell &cell_rec)
+{
+  const SnapshotLibrary &lib_rec = libraries_[cell_rec.library];
+  char brkt_left = lib_rec.bus_brkt_left;
+  char brkt_right = lib_rec.bus_brkt_right;
+  // Cells made in an existing library use its bus brackets.
+  Library *library = network_->findLibrary(findString(lib_rec.name));
+  if (library) {
+    ConcreteLibrary *clib = reinterpret_cast<ConcreteLibrary*>(library);
+    brkt_left = clib->busBrktLeft();
+    brkt_right = clib->busBrktRight();
+  }
+  set<string> port_bits;
+  for (size_t i = 0; i < cell_rec.port_count; i++) {
+    const SnapshotPort &port_rec = ports_[cell_rec.port_begin + i];
+    const char *port_name = findString(port_rec.name);
+    switch (SnapshotPortKind(port_rec.kind)) {
+    case SnapshotPortKind::scalar:
+      port_bits.insert(port_name);
+      break;
+    case SnapshotPortKind::bus: {
+      int from = int(port_rec.from_index);
+      int to = int(port_rec.to_index);
+      int incr = (from <= to) ? 1 : -1;
+      for (int index = from; ; index += incr) {
+	string bit_name;
+	stringPrint(bit_name, "%s%c%d%c",
+		    port_name, brkt_left, index, brkt_right);
+	port_bits.insert(bit_name);
+	if (index == to)
+	  break;
+      }
+      break;
+    }
+    case SnapshotPortKind::bundle:
+      break;
+    }
+  }
+  for (size_t i = 0; i < cell_rec.bit_count; i++) {
+    const char *bit_name = findString(bits_[cell_rec.bit_begin + i]);
+    if (bit_name && port_bits.find(bit_name) == port_bits.end())
+      network_->report()->error(812, "%s cell %s port %s not found.",
+				filename_,
+				findString(cell_rec.name),
+				bit_name);
+  }
+}
+
+Instance *
+NetworkSnapshotReader::makeNetwork()
+{
+  vector<Instance*> insts(header_->instance_count, nullptr);
+  for (size_t i = 0; i < header_->instance_count; i++) {
+    const SnapshotInstance &inst_rec = instances_[i];
+    Instance *parent = (inst_rec.parent == snapshot_null)
+      ? nullptr
+      : insts[inst_rec.parent];
+    insts[i] = network_->makeInstance(cell_seq_[inst_rec.cell],
+				      findString(inst_rec.name),
+				      parent);
+  }
+
+  vector<Net*> nets(header_->net_count, nullptr);
+  for (size_t i = 0; i < header_->net_count; i++) {
+    const SnapshotNet &net_rec = nets_[i];
+    Net *net = network_->makeNet(findString(net_rec.name),
+				 insts[net_rec.instance]);
+    nets[i] = net;
+    LogicValue value = LogicValue(net_rec.constant);
+    if (net_rec.merged_into == snapshot_null
+	&& (value == LogicValue::zero
+	    || value == LogicValue::one))
+      network_->addConstantNet(net, value);
+  }
+
+  for (size_t i = 0; i < header_->instance_count; i++) {
+    const SnapshotInstance &inst_rec = instances_[i];
+    const SnapshotCell &cell_rec = cells_[inst_rec.cell];
+    Instance *inst = insts[i];
+    for (size_t p = 0; p < inst_rec.pin_count; p++) {
+      const SnapshotPin &pin_rec = pins_[inst_rec.pin_begin + p];
+      Port *port = bit_ports_[cell_rec.bit_begin + pin_rec.bit];
+      Net *net = (pin_rec.net == snapshot_null) ? nullptr : nets[pin_rec.net];
+      Pin *pin = network_->makePin(inst, port, net);
+      if (pin_rec.has_term) {
+	Net *term_net = (pin_rec.term_net == snapshot_null)
+	  ? nullptr
+	  : nets[pin_rec.term_net];
+	network_->makeTerm(pin, term_net);
+      }
+    }
+  }
+
+  // Merged nets only survive as name aliases.
+  for (size_t i = 0; i < header_->net_count; i++) {
+    const SnapshotNet &net_rec = nets_[i];
+    if (net_rec.merged_into != snapshot_null)
+      network_->mergeInto(nets[i], nets[net_rec.merged_into]);
+  }
+  return insts[0];
+}
+
+} // namespace
@@ -210,6 +210,12 @@ NetworkNameAdapter::direction(const Port *port) const
   return network_->direction(port);
 }
 
+ObjectId
+NetworkNameAdapter::id(const Pin *pin) const
+{
+  return network_->id(pin);
+}
+
 VertexId
 NetworkNameAdapter::vertexId(const Pin *pin) const
 {
@@ -309,6 +315,12 @@ NetworkNameAdapter::parent(const Instance *instance) const
   return network_->parent(instance);
 }
 
+ObjectId
+NetworkNameAdapter::id(const Instance *instance) const
+{
+  return network_->id(instance);
+}
+
 bool
 NetworkNameAdapter::isLeaf(const Instance *instance) const
 {
@@ -395,6 +407,12 @@ NetworkNameAdapter::instance(const Net *net) const
   return network_->instance(net);
 }
 
+ObjectId
+NetworkNameAdapter::id(const Net *net) const
+{
+  return network_->id(net);
+}
+
 NetPinIterator *
 NetworkNameAdapter::pinIterator(const Net *net) const
 {
@@ -553,7 +571,9 @@ makeSdcNetwork(Network *network)
 }
 
 SdcNetwork::SdcNetwork(Network *network) :
-  NetworkNameAdapter(network)
+  NetworkNameAdapter(network),
+  path_cache_top_(nullptr),
+  divider_inst_names_(-1)
 {
 }
 
@@ -805,6 +825,44 @@ SdcNetwork::findPin(const char *path_name) const
   return findPin(inst, port_name);
 }
 
+bool
+SdcNetwork::findPins(const StringSeq &path_names,
+		     // Return value.
+		     PinSeq &pins) const
+{
+  if (hasDividerInstanceNames())
+    return false;
+  const Instance *top = topInstance();
+  pins.reserve(pins.size() + path_names.size());
+  for (const char *path_name : path_names) {
+    Pin *pin = nullptr;
+    if (!patternWildcards(path_name)) {
+      pin = findPin(path_name);
+      if (pin && network_->instance(pin) == top)
+	pin = nullptr;
+    }
+    pins.push_back(pin);
+  }
+  return true;
+}
+
+bool
+SdcNetwork::findInstances(const StringSeq &path_names,
+			  // Return value.
+			  InstanceSeq &insts) const
+{
+  if (hasDividerInstanceNames())
+    return false;
+  insts.reserve(insts.size() + path_names.size());
+  for (const char *path_name : path_names) {
+    Instance *inst = nullptr;
+    if (!patternWildcards(path_name))
+      inst = findInstance(path_name);
+    insts.push_back(inst);
+  }
+  return true;
+}
+
 Pin *
 SdcNetwork::findPin(const Instance *instance,
 		    const char *port_name) const
@@ -852,13 +910,30 @@ SdcNetwork::findPinsMatching(const Instance *instance,
     }
     delete child_iter;
   }
-  else
+  else {
+    if (instance == topInstance()
+	&& !pattern->isRegexp()
+	&& !pattern->nocase()
+	&& !pattern->hasWildcards()) {
+      // Plain path names are resolved with the cached instance paths.
+      // findPin only finds the first divider interpretation, so visit
+      // all of them if more than one can match or the first instance
+      // path found does not have the pin.
+      if (!hasDividerInstanceNames()) {
+	Pin *pin = findPin(pattern->pattern());
+	if (pin && network_->instance(pin) != instance) {
+	  pins->push_back(pin);
+	  return;
+	}
+      }
+    }
     visitMatches(instance, pattern,
 		 [&](const Instance *instance,
 		     const PatternMatch *tail)
 		 {
 		   return visitPinTail(instance, tail, pins);
 		 });
+  }
 }
 
 bool
@@ -917,9 +992,17 @@ SdcNetwork::makeInstance(LibertyCell *cell,
 			 Instance *parent)
 {
   const char *escaped_name = escapeDividers(name, this);
+  clearPathCache();
   return network_edit_->makeInstance(cell, escaped_name, parent);
 }
 
+void
+SdcNetwork::deleteInstance(Instance *inst)
+{
+  clearPathCache();
+  network_edit_->deleteInstance(inst);
+}
+
 Net *
 SdcNetwork::makeNet(const char *name,
 		    Instance *parent)
@@ -943,26 +1026,97 @@ SdcNetwork::parsePath(const char *path,
 		      Instance *&inst,
 		      const char *&path_tail) const
 {
-  int divider_count, path_length;
-  scanPath(path, divider_count, path_length);
-  if (divider_count > 0)
+  int divider_count, path_length, last_divider;
+  scanPath(path, divider_count, path_length, last_divider);
+  if (divider_count > 0) {
+    // The instance found only depends on the path up to the last
+    // divider, so SDC files that reference many pins of the same
+    // instance only walk the hierarchy once.
+    std::string prefix(path, last_divider);
+    const Instance *top = topInstance();
+    {
+      std::lock_guard<std::mutex> lock(path_cache_lock_);
+      if (top != path_cache_top_) {
+	path_cache_.clear();
+	path_cache_top_ = top;
+	divider_inst_names_ = -1;
+      }
+      auto prefix_iter = path_cache_.find(prefix);
+      if (prefix_iter != path_cache_.end()) {
+	const SdcPathPrefix &path_prefix = prefix_iter->second;
+	inst = path_prefix.first;
+	path_tail = path + path_prefix.second;
+	return;
+      }
+    }
     parsePath(path, divider_count, path_length, inst, path_tail);
+    std::lock_guard<std::mutex> lock(path_cache_lock_);
+    if (top == path_cache_top_)
+      path_cache_[prefix] = SdcPathPrefix(inst, path_tail - path);
+  }
   else {
     inst = nullptr;
     path_tail = path;
   }
 }
 
+void
+SdcNetwork::clearPathCache()
+{
+  std::lock_guard<std::mutex> lock(path_cache_lock_);
+  path_cache_.clear();
+  path_cache_top_ = nullptr;
+  divider_inst_names_ = -1;
+}
+
+// A path name with dividers only has one instance path interpretation
+// when no instance name includes a divider.
+bool
+SdcNetwork::hasDividerInstanceNames() const
+{
+  const Instance *top = topInstance();
+  std::lock_guard<std::mutex> lock(path_cache_lock_);
+  if (top != path_cache_top_) {
+    path_cache_.clear();
+    path_cache_top_ = top;
+    divider_inst_names_ = -1;
+  }
+  if (divider_inst_names_ == -1)
+    divider_inst_names_ = top && hasDividerInstanceNames(top);
+  return divider_inst_names_ == 1;
+}
+
+bool
+SdcNetwork::hasDividerInstanceNames(const Instance *parent) const
+{
+  bool has_divider = false;
+  InstanceChildIterator *child_iter = network_->childIterator(parent);
+  while (child_iter->hasNext()) {
+    Instance *child = child_iter->next();
+    if (strchr(network_->name(child), divider_)
+	|| (network_->isHierarchical(child)
+	    && hasDividerInstanceNames(child))) {
+      has_divider = true;
+      break;
+    }
+  }
+  delete child_iter;
+  return has_divider;
+}
+
 // Scan the path for unescaped dividers.
 void
 SdcNetwork::scanPath(const char *path,
 		     // Return values.
 		     // Unescaped divider count.
 		     int &divider_count,
-		     int &path_length) const
+		     int &path_length,
+		     // Offset of the last unescaped divider.
+		     int &last_divider) const
 {
   divider_count = 0;
   path_length = 0;
+  last_divider = -1;
   for (const char *s = path; *s; s++) {
     char ch = *s;
     if (ch == escape_) {
@@ -972,8 +1126,10 @@ SdcNetwork::scanPath(const char *path,
 	path_length++;
       }
     }
-    else if (ch == divider_)
+    else if (ch == divider_) {
       divider_count++;
+      last_divider = s - path;
+    }
     path_length++;
   }
 }
@@ -1043,8 +1199,8 @@ SdcNetwork::visitMatches(const Instance *parent,
 						   const PatternMatch *tail)>
 			 visit_tail) const
 {
-  int divider_count, path_length;
-  scanPath(pattern->pattern(), divider_count, path_length);
+  int divider_count, path_length, last_divider;
+  scanPath(pattern->pattern(), divider_count, path_length, last_divider);
 
   // Leave room to escape all the dividers and '\0'.
   int inst_path_length = path_length + divider_count + 1;
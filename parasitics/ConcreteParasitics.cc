@@ -864,8 +864,8 @@ ConcreteParasitics::~ConcreteParasitics()
 bool
 ConcreteParasitics::haveParasitics()
 {
-  return !drvr_parasitic_map_.empty()
-    || !parasitic_network_map_.empty();
+  return !drvr_parasitics_.empty()
+    || !net_parasitics_.empty();
 }
 
 void
@@ -886,32 +886,93 @@ ConcreteParasitics::deleteParasitics()
 {
   int ap_count = corners_->parasiticAnalysisPtCount();
   int ap_rf_count = ap_count * RiseFall::index_count;
-  for (auto drvr_parasitics : drvr_parasitic_map_) {
-    ConcreteParasitic **parasitics = drvr_parasitics.second;
+  for (ConcreteParasitic **parasitics : drvr_parasitics_) {
     if (parasitics) {
       for (int i = 0; i < ap_rf_count; i++)
 	delete parasitics[i];
       delete [] parasitics;
     }
   }
-  drvr_parasitic_map_.clear();
+  drvr_parasitics_.clear();
 
-  for (auto net_parasitics : parasitic_network_map_) {
-    ConcreteParasiticNetwork **parasitics = net_parasitics.second;
+  for (ConcreteParasiticNetwork **parasitics : net_parasitics_) {
     if (parasitics) {
       for (int i = 0; i < ap_count; i++)
 	delete parasitics[i];
       delete [] parasitics;
     }
   }
-  parasitic_network_map_.clear();
+  net_parasitics_.clear();
+}
+
+ConcreteParasitic **
+ConcreteParasitics::drvrParasitics(const Pin *drvr_pin) const
+{
+  ObjectId id = network_->id(drvr_pin);
+  if (id < drvr_parasitics_.size())
+    return drvr_parasitics_[id];
+  else
+    return nullptr;
+}
+
+void
+ConcreteParasitics::setDrvrParasitics(const Pin *drvr_pin,
+				      ConcreteParasitic **parasitics)
+{
+  ObjectId id = network_->id(drvr_pin);
+  if (parasitics) {
+    if (id >= drvr_parasitics_.size())
+      drvr_parasitics_.resize(id + 1, nullptr);
+    drvr_parasitics_[id] = parasitics;
+  }
+  else if (id < drvr_parasitics_.size()) {
+    drvr_parasitics_[id] = nullptr;
+    // Trim deleted entries off the end so the sequence is empty when
+    // there are no parasitics and does not grow with deleted pin ids.
+    while (!drvr_parasitics_.empty()
+	   && drvr_parasitics_.back() == nullptr)
+      drvr_parasitics_.pop_back();
+    if (drvr_parasitics_.empty())
+      ConcreteParasiticSeq().swap(drvr_parasitics_);
+  }
+}
+
+ConcreteParasiticNetwork **
+ConcreteParasitics::netParasitics(const Net *net) const
+{
+  if (net) {
+    ObjectId id = network_->id(net);
+    if (id < net_parasitics_.size())
+      return net_parasitics_[id];
+  }
+  return nullptr;
+}
+
+void
+ConcreteParasitics::setNetParasitics(const Net *net,
+				     ConcreteParasiticNetwork **parasitics)
+{
+  ObjectId id = network_->id(net);
+  if (parasitics) {
+    if (id >= net_parasitics_.size())
+      net_parasitics_.resize(id + 1, nullptr);
+    net_parasitics_[id] = parasitics;
+  }
+  else if (id < net_parasitics_.size()) {
+    net_parasitics_[id] = nullptr;
+    while (!net_parasitics_.empty()
+	   && net_parasitics_.back() == nullptr)
+      net_parasitics_.pop_back();
+    if (net_parasitics_.empty())
+      ConcreteParasiticNetworkSeq().swap(net_parasitics_);
+  }
 }
 
 void
 ConcreteParasitics::deleteParasitics(const Pin *drvr_pin,
 				     const ParasiticAnalysisPt *ap)
 {
-  ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
+  ConcreteParasitic **parasitics = drvrParasitics(drvr_pin);
   if (parasitics) {
     for (auto tr : RiseFall::range()) {
       int ap_rf_index = parasiticAnalysisPtIndex(ap, tr);
@@ -929,7 +990,7 @@ ConcreteParasitics::deleteParasitics(const Net *net,
   for (auto drvr_pin : *drivers)
     deleteParasitics(drvr_pin, ap);
 
-  ConcreteParasiticNetwork **parasitics = parasitic_network_map_[net];
+  ConcreteParasiticNetwork **parasitics = netParasitics(net);
   if (parasitics) {
     delete parasitics[ap->index()];
     parasitics[ap->index()] = nullptr;
@@ -979,7 +1040,7 @@ ConcreteParasitics::disconnectPinBefore(const Pin *pin)
 
     Net *net = findParasiticNet(pin);
     if (net) {
-      ConcreteParasiticNetwork **parasitics = parasitic_network_map_[net];
+      ConcreteParasiticNetwork **parasitics = netParasitics(net);
       if (parasitics) {
         int ap_count = corners_->parasiticAnalysisPtCount();
 	for (int i = 0; i < ap_count; i++) {
@@ -1003,7 +1064,7 @@ void
 ConcreteParasitics::deleteReducedParasitics(const Net *net,
                                             const ParasiticAnalysisPt *ap)
 {
-  if (!drvr_parasitic_map_.empty()) {
+  if (!drvr_parasitics_.empty()) {
     PinSet *drivers = network_->drivers(net);
     if (drivers) {
       for (auto drvr_pin : *drivers)
@@ -1016,7 +1077,7 @@ ConcreteParasitics::deleteReducedParasitics(const Net *net,
 void
 ConcreteParasitics::deleteReducedParasitics(const Pin *pin)
 {
-  if (!drvr_parasitic_map_.empty()) {
+  if (!drvr_parasitics_.empty()) {
     PinSet *drivers = network_->drivers(pin);
     if (drivers) {
       for (auto drvr_pin : *drivers)
@@ -1029,15 +1090,15 @@ void
 ConcreteParasitics::deleteDrvrReducedParasitics(const Pin *drvr_pin)
 {
   UniqueLock lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
+  ConcreteParasitic **parasitics = drvrParasitics(drvr_pin);
   if (parasitics) {
     int ap_count = corners_->parasiticAnalysisPtCount();
     int ap_rf_count = ap_count * RiseFall::index_count;
     for (int i = 0; i < ap_rf_count; i++)
       delete parasitics[i];
     delete [] parasitics;
+    setDrvrParasitics(drvr_pin, nullptr);
   }
-  drvr_parasitic_map_[drvr_pin] = nullptr;
 }
 
 void
@@ -1045,7 +1106,7 @@ ConcreteParasitics::deleteDrvrReducedParasitics(const Pin *drvr_pin,
                                                 const ParasiticAnalysisPt *ap)
 {
   UniqueLock lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
+  ConcreteParasitic **parasitics = drvrParasitics(drvr_pin);
   if (parasitics) {
     int ap_index = ap->index();
     delete parasitics[ap_index];
@@ -1067,10 +1128,10 @@ ConcreteParasitics::findPiElmore(const Pin *drvr_pin,
 				 const RiseFall *rf,
 				 const ParasiticAnalysisPt *ap) const
 {
-  if (!drvr_parasitic_map_.empty()) {
+  if (!drvr_parasitics_.empty()) {
     int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
     UniqueLock lock(lock_);
-    ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
+    ConcreteParasitic **parasitics = drvrParasitics(drvr_pin);
     if (parasitics) {
       ConcreteParasitic *parasitic = parasitics[ap_rf_index];
       if (parasitic == nullptr && rf == RiseFall::fall()) {
@@ -1093,14 +1154,14 @@ ConcreteParasitics::makePiElmore(const Pin *drvr_pin,
 				 float c1)
 {
   UniqueLock lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
+  ConcreteParasitic **parasitics = drvrParasitics(drvr_pin);
   if (parasitics == nullptr) {
     int ap_count = corners_->parasiticAnalysisPtCount();
     int ap_rf_count = ap_count * RiseFall::index_count;
     parasitics = new ConcreteParasitic*[ap_rf_count];
     for (int i = 0; i < ap_rf_count; i++)
       parasitics[i] = nullptr;
-    drvr_parasitic_map_[drvr_pin] = parasitics;
+    setDrvrParasitics(drvr_pin, parasitics);
   }
   int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
   ConcreteParasitic *parasitic = parasitics[ap_rf_index];
@@ -1187,10 +1248,10 @@ ConcreteParasitics::findPiPoleResidue(const Pin *drvr_pin,
 				      const RiseFall *rf,
 				      const ParasiticAnalysisPt *ap) const
 {
-  if (!drvr_parasitic_map_.empty()) {
+  if (!drvr_parasitics_.empty()) {
     int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
     UniqueLock lock(lock_);
-    ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
+    ConcreteParasitic **parasitics = drvrParasitics(drvr_pin);
     if (parasitics) {
       ConcreteParasitic *parasitic = parasitics[ap_rf_index];
       if (parasitic == nullptr && rf == RiseFall::fall()) {
@@ -1213,14 +1274,14 @@ ConcreteParasitics::makePiPoleResidue(const Pin *drvr_pin,
 				      float c1)
 {
   UniqueLock lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
+  ConcreteParasitic **parasitics = drvrParasitics(drvr_pin);
   if (parasitics == nullptr) {
     int ap_count = corners_->parasiticAnalysisPtCount();
     int ap_rf_count = ap_count * RiseFall::index_count;
     parasitics = new ConcreteParasitic*[ap_rf_count];
     for (int i = 0; i < ap_rf_count; i++)
       parasitics[i] = nullptr;
-    drvr_parasitic_map_[drvr_pin] = parasitics;
+    setDrvrParasitics(drvr_pin, parasitics);
   }
   int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
   ConcreteParasitic *parasitic = parasitics[ap_rf_index];
@@ -1305,10 +1366,10 @@ Parasitic *
 ConcreteParasitics::findParasiticNetwork(const Net *net,
 					 const ParasiticAnalysisPt *ap) const
 {
-  if (!parasitic_network_map_.empty()) {
+  if (!net_parasitics_.empty()) {
     UniqueLock lock(lock_);
-    if (!parasitic_network_map_.empty()) {
-      ConcreteParasiticNetwork **parasitics=parasitic_network_map_.findKey(net);
+    if (!net_parasitics_.empty()) {
+      ConcreteParasiticNetwork **parasitics = netParasitics(net);
       if (parasitics)
 	return parasitics[ap->index()];
     }
@@ -1320,12 +1381,12 @@ Parasitic *
 ConcreteParasitics::findParasiticNetwork(const Pin *pin,
 					 const ParasiticAnalysisPt *ap) const
 {
-  if (!parasitic_network_map_.empty()) {
+  if (!net_parasitics_.empty()) {
     UniqueLock lock(lock_);
-    if (!parasitic_network_map_.empty()) {
+    if (!net_parasitics_.empty()) {
       // Only call findParasiticNet if parasitics exist.
       Net *net = findParasiticNet(pin);
-      ConcreteParasiticNetwork **parasitics=parasitic_network_map_.findKey(net);
+      ConcreteParasiticNetwork **parasitics = netParasitics(net);
       if (parasitics)
 	return parasitics[ap->index()];
     }
@@ -1339,13 +1400,13 @@ ConcreteParasitics::makeParasiticNetwork(const Net *net,
 					 const ParasiticAnalysisPt *ap)
 {
   UniqueLock lock(lock_);
-  ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
+  ConcreteParasiticNetwork **parasitics = netParasitics(net);
   if (parasitics == nullptr) {
     int ap_count = corners_->parasiticAnalysisPtCount();
     parasitics = new ConcreteParasiticNetwork*[ap_count];
     for (int i = 0; i < ap_count; i++)
       parasitics[i] = nullptr;
-    parasitic_network_map_[net] = parasitics;
+    setNetParasitics(net, parasitics);
   }
   int ap_index = ap->index();
   ConcreteParasiticNetwork *parasitic = parasitics[ap_index];
@@ -1360,9 +1421,9 @@ void
 ConcreteParasitics::deleteParasiticNetwork(const Net *net,
 					   const ParasiticAnalysisPt *ap)
 {
-  if (!parasitic_network_map_.empty()) {
+  if (!net_parasitics_.empty()) {
     UniqueLock lock(lock_);
-    ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
+    ConcreteParasiticNetwork **parasitics = netParasitics(net);
     if (parasitics) {
       int ap_index = ap->index();
       delete parasitics[ap_index];
@@ -1370,7 +1431,7 @@ ConcreteParasitics::deleteParasiticNetwork(const Net *net,
       if (ap_count == 1) {
         // If there is only one parasitic we can remove the array and map entry.
         delete [] parasitics;
-        parasitic_network_map_.erase(net);
+        setNetParasitics(net, nullptr);
       }
       else
         parasitics[ap_index] = nullptr;
@@ -1381,15 +1442,15 @@ ConcreteParasitics::deleteParasiticNetwork(const Net *net,
 void
 ConcreteParasitics::deleteParasiticNetworks(const Net *net)
 {
-  if (!parasitic_network_map_.empty()) {
+  if (!net_parasitics_.empty()) {
     UniqueLock lock(lock_);
-    ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
+    ConcreteParasiticNetwork **parasitics = netParasitics(net);
     if (parasitics) {
       int ap_count = corners_->parasiticAnalysisPtCount();
       for (int i = 0; i < ap_count; i++)
 	delete parasitics[i];
       delete [] parasitics;
-      parasitic_network_map_.erase(net);
+      setNetParasitics(net, nullptr);
     }
   }
 }
@@ -33,8 +33,9 @@ class ConcreteParasiticNetwork;
 class ConcreteParasiticNode;
 class ConcreteParasiticDevice;
 
-typedef Map<const Pin*, ConcreteParasitic**> ConcreteParasiticMap;
-typedef Map<const Net*, ConcreteParasiticNetwork**> ConcreteParasiticNetworkMap;
+// Indexed by network pin/net id.
+typedef Vector<ConcreteParasitic**> ConcreteParasiticSeq;
+typedef Vector<ConcreteParasiticNetwork**> ConcreteParasiticNetworkSeq;
 
 // This class acts as a BUILDER for all parasitics.
 class ConcreteParasitics : public Parasitics, public EstimateParasitics
@@ -205,11 +206,18 @@ protected:
   void deleteReducedParasitics(const Pin *pin);
   void deleteDrvrReducedParasitics(const Pin *drvr_pin,
                                    const ParasiticAnalysisPt *ap);
-
-  // Driver pin to array of parasitics indexed by analysis pt index
+  ConcreteParasitic **drvrParasitics(const Pin *drvr_pin) const;
+  void setDrvrParasitics(const Pin *drvr_pin,
+			 ConcreteParasitic **parasitics);
+  ConcreteParasiticNetwork **netParasitics(const Net *net) const;
+  void setNetParasitics(const Net *net,
+			ConcreteParasiticNetwork **parasitics);
+
+  // Driver pin id to array of parasitics indexed by analysis pt index
   // and transition.
-  ConcreteParasiticMap drvr_parasitic_map_;
-  ConcreteParasiticNetworkMap parasitic_network_map_;
+  ConcreteParasiticSeq drvr_parasitics_;
+  // Net id to array of parasitic networks indexed by analysis pt index.
+  ConcreteParasiticNetworkSeq net_parasitics_;
   mutable std::mutex lock_;
 
   using EstimateParasitics::estimatePiElmore;
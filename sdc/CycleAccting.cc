@@ -29,7 +29,9 @@
 namespace sta {
 
 CycleAcctings::CycleAcctings(Sdc *sdc) :
-  sdc_(sdc)
+  sdc_(sdc),
+  table_(nullptr),
+  table_edge_count_(0)
 {
 }
 
@@ -41,9 +43,39 @@ CycleAcctings::~CycleAcctings()
 void
 CycleAcctings::clear()
 {
+  deleteTable();
   cycle_acctings_.deleteContentsClear();
 }
 
+void
+CycleAcctings::deleteTable()
+{
+  int edge_count = table_edge_count_;
+  for (int i = 0; i < edge_count; i++)
+    delete [] table_[i].load();
+  delete [] table_;
+  table_ = nullptr;
+  table_edge_count_ = 0;
+}
+
+// Size the table for the clocks that exist.
+// Clocks are not defined during search, and defining a clock clears
+// the table.
+void
+CycleAcctings::ensureTable()
+{
+  if (table_ == nullptr) {
+    int clk_index_max = sdc_->defaultArrivalClock()->index();
+    for (Clock *clk : *sdc_->clocks())
+      clk_index_max = std::max(clk_index_max, clk->index());
+    int edge_count = (clk_index_max + 1) * RiseFall::index_count;
+    table_ = new std::atomic<std::atomic<CycleAccting*>*>[edge_count];
+    for (int i = 0; i < edge_count; i++)
+      table_[i] = nullptr;
+    table_edge_count_ = edge_count;
+  }
+}
+
 // Determine cycle accounting "on demand".
 CycleAccting *
 CycleAcctings::cycleAccting(const ClockEdge *src,
@@ -60,10 +92,44 @@ CycleAcctings::cycleAccting(const ClockEdge *src,
     else
       acct->findDelays(sdc_);
     cycle_acctings_.insert(acct);
+
+    ensureTable();
+    int src_index = src->index();
+    int tgt_index = tgt->index();
+    int edge_count = table_edge_count_;
+    if (src_index < edge_count
+	&& tgt_index < edge_count) {
+      std::atomic<CycleAccting*> *row = table_[src_index];
+      if (row == nullptr) {
+	row = new std::atomic<CycleAccting*>[edge_count];
+	for (int i = 0; i < edge_count; i++)
+	  row[i] = nullptr;
+	table_[src_index] = row;
+      }
+      row[tgt_index] = acct;
+    }
   }
   return acct;
 }
 
+CycleAccting *
+CycleAcctings::findCycleAccting(const ClockEdge *src,
+				const ClockEdge *tgt) const
+{
+  if (src == nullptr)
+    src = tgt;
+  int src_index = src->index();
+  int tgt_index = tgt->index();
+  int edge_count = table_edge_count_;
+  if (src_index < edge_count
+      && tgt_index < edge_count) {
+    std::atomic<CycleAccting*> *row = table_[src_index];
+    if (row)
+      return row[tgt_index];
+  }
+  return nullptr;
+}
+
 void
 CycleAcctings::reportClkToClkMaxCycleWarnings(Report *report)
 {
@@ -107,6 +107,7 @@ Sdc::Sdc(StaState *sta) :
   first_to_clk_exceptions_(nullptr),
   first_to_inst_exceptions_(nullptr),
   first_thru_edge_exceptions_(nullptr),
+  exception_thrus_valid_(false),
   path_delay_internal_startpoints_(nullptr),
   path_delay_internal_endpoints_(nullptr)
 {
@@ -263,7 +264,7 @@ Sdc::deleteConstraints()
   clk_gating_check_map_.deleteContents();
   inst_clk_gating_check_map_.deleteContents();
   pin_clk_gating_check_map_.deleteContents();
-  input_drive_map_.deleteContents();
+  input_drive_map_.deleteContentsClear();
   disabled_cell_ports_.deleteContents();
   disabled_inst_ports_.deleteContents();
   pin_min_pulse_width_map_.deleteContentsClear();
@@ -285,14 +286,14 @@ Sdc::deleteConstraints()
 
   for (InputDelay *input_delay : input_delays_)
     delete input_delay;
-  input_delay_pin_map_.deleteContents();
+  input_delay_pin_map_.deleteContentsClear();
   input_delay_leaf_pin_map_.deleteContents();
   input_delay_ref_pin_map_.deleteContents();
   input_delay_internal_pin_map_.deleteContents();
 
   for (OutputDelay *output_delay : output_delays_)
     delete output_delay;
-  output_delay_pin_map_.deleteContents();
+  output_delay_pin_map_.deleteContentsClear();
   output_delay_ref_pin_map_.deleteContents();
   output_delay_leaf_pin_map_.deleteContents();
 
@@ -339,11 +340,8 @@ Sdc::removeNetLoadCaps()
 void
 Sdc::removeLoadCaps()
 {
-  if (port_cap_map_) {
-    port_cap_map_->deleteContents();
-    delete port_cap_map_;
-    port_cap_map_ = nullptr;
-  }
+  delete port_cap_map_;
+  port_cap_map_ = nullptr;
   removeNetLoadCaps();
 }
 
@@ -428,8 +426,8 @@ Sdc::isConstrained(const Pin *pin) const
     || pin_clk_gating_check_map_.hasKey(pin)
     || data_checks_from_map_.hasKey(pin)
     || data_checks_to_map_.hasKey(pin)
-    || input_delay_pin_map_.hasKey(pin)
-    || output_delay_pin_map_.hasKey(pin)
+    || input_delay_pin_map_.hasKey(network_->id(pin))
+    || output_delay_pin_map_.hasKey(network_->id(pin))
     || port_slew_limit_map_.hasKey(port)
     || pin_cap_limit_map_.hasKey(pin1)
     || port_cap_limit_map_.hasKey(port)
@@ -444,7 +442,7 @@ Sdc::isConstrained(const Pin *pin) const
 	&& first_thru_pin_exceptions_->hasKey(pin))
     || (first_to_pin_exceptions_
 	&& first_to_pin_exceptions_->hasKey(pin))
-    || input_drive_map_.hasKey(port)
+    || (port && input_drive_map_.hasKey(network_->id(pin)))
     || logic_value_map_.hasKey(pin)
     || case_value_map_.hasKey(pin)
     || pin_latch_borrow_limit_map_.hasKey(pin)
@@ -723,8 +721,11 @@ Sdc::setDriveCell(LibertyLibrary *library,
 		  const RiseFallBoth *rf,
 		  const MinMaxAll *min_max)
 {
-  ensureInputDrive(port)->setDriveCell(library, cell, from_port, from_slews,
-				       to_port, rf, min_max);
+  InputDriveSeq drives;
+  ensureInputDrives(port, drives);
+  for (InputDrive *drive : drives)
+    drive->setDriveCell(library, cell, from_port, from_slews,
+			to_port, rf, min_max);
 }
 
 void
@@ -733,7 +734,10 @@ Sdc::setInputSlew(Port *port,
 		  const MinMaxAll *min_max,
 		  float slew)
 {
-  ensureInputDrive(port)->setSlew(rf, min_max, slew);
+  InputDriveSeq drives;
+  ensureInputDrives(port, drives);
+  for (InputDrive *drive : drives)
+    drive->setSlew(rf, min_max, slew);
 }
 
 void
@@ -742,18 +746,39 @@ Sdc::setDriveResistance(Port *port,
 			const MinMaxAll *min_max,
 			float res)
 {
-  ensureInputDrive(port)->setDriveResistance(rf, min_max, res);
+  InputDriveSeq drives;
+  ensureInputDrives(port, drives);
+  for (InputDrive *drive : drives)
+    drive->setDriveResistance(rf, min_max, res);
 }
 
-InputDrive *
-Sdc::ensureInputDrive(Port *port)
+// Drives are indexed by port bit pins, so bus and bundle port drives
+// are set on their member bits.
+void
+Sdc::ensureInputDrives(Port *port,
+		       // Return value.
+		       InputDriveSeq &drives)
 {
-  InputDrive *drive = input_drive_map_.findKey(port);
-  if (drive == nullptr) {
-    drive = new InputDrive;
-    input_drive_map_[port] = drive;
+  if (network_->hasMembers(port)) {
+    PortMemberIterator *member_iter = network_->memberIterator(port);
+    while (member_iter->hasNext()) {
+      Port *member = member_iter->next();
+      ensureInputDrives(member, drives);
+    }
+    delete member_iter;
+  }
+  else {
+    const Pin *pin = network_->findPin(network_->topInstance(), port);
+    if (pin) {
+      ObjectId pin_id = network_->id(pin);
+      InputDrive *drive = input_drive_map_.findKey(pin_id);
+      if (drive == nullptr) {
+	drive = new InputDrive;
+	input_drive_map_.insert(pin, pin_id, drive);
+      }
+      drives.push_back(drive);
+    }
   }
-  return drive;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -2392,12 +2417,17 @@ Sdc::clockGatingActiveValue(const Pin *clk_pin,
 ////////////////////////////////////////////////////////////////
 
 // Determine cycle accounting "on demand".
+// Cycle acctings that have been found are read without locking.
 CycleAccting *
 Sdc::cycleAccting(const ClockEdge *src,
 		  const ClockEdge *tgt)
 {
-  UniqueLock lock(cycle_acctings_lock_);
-  return cycle_acctings_.cycleAccting(src, tgt);
+  CycleAccting *acct = cycle_acctings_.findCycleAccting(src, tgt);
+  if (acct == nullptr) {
+    UniqueLock lock(cycle_acctings_lock_);
+    acct = cycle_acctings_.cycleAccting(src, tgt);
+  }
+  return acct;
 }
 
 void
@@ -2623,7 +2653,18 @@ Sdc::deleteMinPulseWidthReferencing(Clock *clk)
 InputDrive *
 Sdc::findInputDrive(Port *port)
 {
-  return input_drive_map_.findKey(port);
+  if (input_drive_map_.empty()
+      // Bus and bundle ports do not have a pin.
+      || network_->hasMembers(port))
+    return nullptr;
+  else
+    return findInputDrive(network_->findPin(network_->topInstance(), port));
+}
+
+InputDrive *
+Sdc::findInputDrive(const Pin *port_pin)
+{
+  return input_drive_map_.findKey(network_->id(port_pin));
 }
 
 void
@@ -2664,10 +2705,11 @@ Sdc::makeInputDelay(Pin *pin,
 					   input_delay_index_++,
 					   network_);
   input_delays_.insert(input_delay);
-  InputDelaySet *inputs = input_delay_pin_map_.findKey(pin);
+  ObjectId pin_id = network_->id(pin);
+  InputDelaySet *inputs = input_delay_pin_map_.findKey(pin_id);
   if (inputs == nullptr) {
     inputs = new InputDelaySet;
-    input_delay_pin_map_[pin] = inputs;
+    input_delay_pin_map_.insert(pin, pin_id, inputs);
   }
   inputs->insert(input_delay);
 
@@ -2681,7 +2723,7 @@ Sdc::makeInputDelay(Pin *pin,
   }
 
   for (Pin *lpin : input_delay->leafPins()) {
-    InputDelaySet *leaf_inputs = input_delay_leaf_pin_map_[lpin];
+    InputDelaySet *leaf_inputs = input_delay_leaf_pin_map_.findKey(lpin);
     if (leaf_inputs == nullptr) {
       leaf_inputs = new InputDelaySet;
       input_delay_leaf_pin_map_[lpin] = leaf_inputs;
@@ -2705,7 +2747,7 @@ Sdc::findInputDelay(const Pin *pin,
 		    ClockEdge *clk_edge,
 		    Pin *ref_pin)
 {
-  InputDelaySet *inputs = input_delay_pin_map_.findKey(pin);
+  InputDelaySet *inputs = input_delay_pin_map_.findKey(network_->id(pin));
   if (inputs) {
     for (InputDelay *input_delay : *inputs) {
       if (input_delay->clkEdge() == clk_edge
@@ -2737,7 +2779,8 @@ void
 Sdc::deleteInputDelays(Pin *pin,
 		       InputDelay *except)
 {
-  InputDelaySet *input_delays = input_delay_pin_map_[pin];
+  InputDelaySet *input_delays =
+    input_delay_pin_map_.findKey(network_->id(pin));
   InputDelaySet::Iterator iter(input_delays);
   while (iter.hasNext()) {
     InputDelay *input_delay = iter.next();
@@ -2788,11 +2831,11 @@ Sdc::deleteInputDelay(InputDelay *input_delay)
   input_delays_.erase(input_delay);
 
   Pin *pin = input_delay->pin();
-  InputDelaySet *inputs = input_delay_pin_map_[pin];
+  InputDelaySet *inputs = input_delay_pin_map_.findKey(network_->id(pin));
   inputs->erase(input_delay);
 
   for (Pin *lpin : input_delay->leafPins()) {
-    InputDelaySet *inputs = input_delay_leaf_pin_map_[lpin];
+    InputDelaySet *inputs = input_delay_leaf_pin_map_.findKey(lpin);
     inputs->erase(input_delay);
   }
 
@@ -2835,7 +2878,7 @@ Sdc::findOutputDelay(const Pin *pin,
 		     ClockEdge *clk_edge,
 		     Pin *ref_pin)
 {
-  OutputDelaySet *outputs = output_delay_pin_map_.findKey(pin);
+  OutputDelaySet *outputs = output_delay_pin_map_.findKey(network_->id(pin));
   if (outputs) {
     for (OutputDelay *output_delay : *outputs) {
       if (output_delay->clkEdge() == clk_edge
@@ -2854,10 +2897,11 @@ Sdc::makeOutputDelay(Pin *pin,
   OutputDelay *output_delay = new OutputDelay(pin, clk_edge, ref_pin,
 					      network_);
   output_delays_.insert(output_delay);
-  OutputDelaySet *outputs = output_delay_pin_map_.findKey(pin);
+  ObjectId pin_id = network_->id(pin);
+  OutputDelaySet *outputs = output_delay_pin_map_.findKey(pin_id);
   if (outputs == nullptr) {
     outputs = new OutputDelaySet;
-    output_delay_pin_map_[pin] = outputs;
+    output_delay_pin_map_.insert(pin, pin_id, outputs);
   }
   outputs->insert(output_delay);
 
@@ -2871,7 +2915,7 @@ Sdc::makeOutputDelay(Pin *pin,
   }
 
   for (Pin *lpin : output_delay->leafPins()) {
-    OutputDelaySet *leaf_outputs = output_delay_leaf_pin_map_[lpin];
+    OutputDelaySet *leaf_outputs = output_delay_leaf_pin_map_.findKey(lpin);
     if (leaf_outputs == nullptr) {
       leaf_outputs = new OutputDelaySet;
       output_delay_leaf_pin_map_[lpin] = leaf_outputs;
@@ -2900,7 +2944,8 @@ void
 Sdc::deleteOutputDelays(Pin *pin,
 			OutputDelay *except)
 {
-  OutputDelaySet *output_delays = output_delay_pin_map_[pin];
+  OutputDelaySet *output_delays =
+    output_delay_pin_map_.findKey(network_->id(pin));
   OutputDelaySet::Iterator iter(output_delays);
   while (iter.hasNext()) {
     OutputDelay *output_delay = iter.next();
@@ -2938,11 +2983,11 @@ Sdc::deleteOutputDelay(OutputDelay *output_delay)
   output_delays_.erase(output_delay);
 
   Pin *pin = output_delay->pin();
- OutputDelaySet *outputs = output_delay_pin_map_[pin];
+ OutputDelaySet *outputs = output_delay_pin_map_.findKey(network_->id(pin));
   outputs->erase(output_delay);
 
   for (Pin *lpin : output_delay->leafPins()) {
-    OutputDelaySet *outputs = output_delay_leaf_pin_map_[lpin];
+    OutputDelaySet *outputs = output_delay_leaf_pin_map_.findKey(lpin);
     outputs->erase(output_delay);
   }
 
@@ -2983,10 +3028,12 @@ Sdc::setPortExtWireCap(Port *port,
 PortExtCap *
 Sdc::portExtCap(Port *port) const
 {
-  if (port_cap_map_)
-    return port_cap_map_->findKey(port);
-  else
-    return nullptr;
+  if (port_cap_map_) {
+    auto port_cap_iter = port_cap_map_->find(port);
+    if (port_cap_iter != port_cap_map_->end())
+      return &port_cap_iter->second;
+  }
+  return nullptr;
 }
 
 bool
@@ -3010,14 +3057,12 @@ Sdc::portExtCap(Port *port,
 		int &fanout,
 		bool &has_fanout) const
 {
-  if (port_cap_map_) {
-    PortExtCap *port_cap = port_cap_map_->findKey(port);
-    if (port_cap) {
-      port_cap->pinCap(rf, min_max, pin_cap, has_pin_cap);
-      port_cap->wireCap(rf, min_max, wire_cap, has_wire_cap);
-      port_cap->fanout(min_max, fanout, has_fanout);
-      return;
-    }
+  PortExtCap *port_cap = portExtCap(port);
+  if (port_cap) {
+    port_cap->pinCap(rf, min_max, pin_cap, has_pin_cap);
+    port_cap->wireCap(rf, min_max, wire_cap, has_wire_cap);
+    port_cap->fanout(min_max, fanout, has_fanout);
+    return;
   }
   pin_cap = 0.0F;
   has_pin_cap = false;
@@ -3383,12 +3428,10 @@ Sdc::ensurePortExtPinCap(Port *port)
 {
   if (port_cap_map_ == nullptr)
     port_cap_map_ = new PortExtCapMap;
-  PortExtCap *port_cap = port_cap_map_->findKey(port);
-  if (port_cap == nullptr) {
-    port_cap = new PortExtCap(port);
-    (*port_cap_map_)[port] = port_cap;
-  }
-  return port_cap;
+  auto port_cap_iter = port_cap_map_->find(port);
+  if (port_cap_iter == port_cap_map_->end())
+    port_cap_iter = port_cap_map_->emplace(port, PortExtCap(port)).first;
+  return &port_cap_iter->second;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -4639,6 +4682,7 @@ Sdc::recordException(ExceptionPath *exception)
   recordMergeHashes(exception);
   recordExceptionFirstPts(exception);
   checkForThruHpins(exception);
+  exceptionThrusInvalid();
 }
 
 void
@@ -4698,6 +4742,39 @@ Sdc::recordExceptionFirstPts(ExceptionPath *exception)
     recordExceptionFirstTo(exception);
 }
 
+// Record the objects of merged_pt as first points of exception.
+void
+Sdc::recordMergedFirstPt(ExceptionPath *exception,
+			 ExceptionPt *merged_pt)
+{
+  if (exception->from()) {
+    recordExceptionPins(exception, merged_pt->pins(),
+			first_from_pin_exceptions_);
+    recordExceptionInsts(exception, merged_pt->instances(),
+			 first_from_inst_exceptions_);
+    recordExceptionClks(exception, merged_pt->clks(),
+			first_from_clk_exceptions_);
+  }
+  else if (exception->thrus()) {
+    recordExceptionPins(exception, merged_pt->pins(),
+			first_thru_pin_exceptions_);
+    recordExceptionInsts(exception, merged_pt->instances(),
+			 first_thru_inst_exceptions_);
+    recordExceptionEdges(exception, merged_pt->edges(),
+			 first_thru_edge_exceptions_);
+    recordExceptionNets(exception, merged_pt->nets(),
+			first_thru_net_exceptions_);
+  }
+  else if (exception->to()) {
+    recordExceptionPins(exception, merged_pt->pins(),
+			first_to_pin_exceptions_);
+    recordExceptionInsts(exception, merged_pt->instances(),
+			 first_to_inst_exceptions_);
+    recordExceptionClks(exception, merged_pt->clks(),
+			first_to_clk_exceptions_);
+  }
+}
+
 void
 Sdc::recordExceptionFirstFrom(ExceptionPath *exception)
 {
@@ -4904,12 +4981,14 @@ Sdc::findMergeMatch(ExceptionPath *exception)
 	  // Unrecord the exception that is being merged away.
 	  unrecordException(exception);
 	  unrecordMergeHashes(match);
-	  missing_pt->mergeInto(match_missing_pt);
-	  recordMergeHashes(match);
 	  // First point maps only change if the exception point that
 	  // is being merged is the first exception point.
+	  // Only the merged objects are recorded so merging many
+	  // exceptions into one is not quadratic.
 	  if (first_pt)
-	    recordExceptionFirstPts(match);
+	    recordMergedFirstPt(match, missing_pt);
+	  missing_pt->mergeInto(match_missing_pt);
+	  recordMergeHashes(match);
           // Have to wait until after exception point merge to delete
           // the exception.
 	  delete exception;
@@ -4953,6 +5032,7 @@ Sdc::deleteExceptions()
   deleteExceptionPtHashMapSets(exception_merge_hash_);
   exception_merge_hash_.clear();
   have_thru_hpin_exceptions_ = false;
+  exceptionThrusInvalid();
 }
 
 void
@@ -5090,6 +5170,7 @@ Sdc::unrecordException(ExceptionPath *exception)
   unrecordMergeHashes(exception);
   unrecordExceptionFirstPts(exception);
   exceptions_.erase(exception);
+  exceptionThrusInvalid();
 }
 
 void
@@ -5513,6 +5594,62 @@ Sdc::exceptionThruStates(const ExceptionPathSet *exceptions,
   }
 }
 
+bool
+Sdc::isExceptionThruEdge(const Pin *from_pin,
+			 const Pin *to_pin)
+{
+  if (!exception_thrus_valid_) {
+    UniqueLock lock(exception_thrus_lock_);
+    if (!exception_thrus_valid_)
+      findExceptionThrus();
+  }
+  if (exception_thru_pins_.hasKey(const_cast<Pin*>(to_pin)))
+    return true;
+  if (!exception_thru_edges_.empty()) {
+    EdgePins edge_pins(const_cast<Pin*>(from_pin), const_cast<Pin*>(to_pin));
+    if (exception_thru_edges_.hasKey(&edge_pins))
+      return true;
+  }
+  return (!exception_thru_nets_.empty()
+	  && exception_thru_nets_.hasKey(network_->net(to_pin)))
+    || (!exception_thru_insts_.empty()
+	&& exception_thru_insts_.hasKey(network_->instance(to_pin)));
+}
+
+// Collect the points of every -thru, not just the first ones, so
+// edges that cannot advance any exception state are found with a
+// few lookups instead of matching each state of each tag.
+void
+Sdc::findExceptionThrus()
+{
+  exception_thru_pins_.clear();
+  exception_thru_insts_.clear();
+  exception_thru_nets_.clear();
+  exception_thru_edges_.clear();
+  for (ExceptionPath *exception : exceptions_) {
+    ExceptionThruSeq *thrus = exception->thrus();
+    if (thrus) {
+      for (ExceptionThru *thru : *thrus) {
+	if (thru->pins())
+	  exception_thru_pins_.insertSet(thru->pins());
+	if (thru->instances())
+	  exception_thru_insts_.insertSet(thru->instances());
+	if (thru->nets())
+	  exception_thru_nets_.insertSet(thru->nets());
+	if (thru->edges())
+	  exception_thru_edges_.insertSet(thru->edges());
+      }
+    }
+  }
+  exception_thrus_valid_ = true;
+}
+
+void
+Sdc::exceptionThrusInvalid()
+{
+  exception_thrus_valid_ = false;
+}
+
 void
 Sdc::exceptionTo(ExceptionPathType type,
 		 const Pin *pin,
@@ -5908,6 +6045,7 @@ Sdc::connectPinAfter(Pin *pin)
         }
       }
     }
+    exceptionThrusInvalid();
   }
 }
 
@@ -5930,6 +6068,7 @@ Sdc::disconnectPinBefore(Pin *pin)
         }
       }
     }
+    exceptionThrusInvalid();
   }
 }
 
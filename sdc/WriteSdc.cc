@@ -17,7 +17,9 @@
 #include "WriteSdc.hh"
 
 #include <stdio.h>
+#include <stdarg.h>
 #include <algorithm>
+#include <set>
 #include <time.h>
 
 #include "Zlib.hh"
@@ -30,6 +32,7 @@
 #include "Network.hh"
 #include "PortDirection.hh"
 #include "NetworkCmp.hh"
+#include "ParseBus.hh"
 #include "Graph.hh"
 #include "GraphCmp.hh"
 #include "RiseFallValues.hh"
@@ -46,6 +49,7 @@
 #include "Sdc.hh"
 #include "Fuzzy.hh"
 #include "StaState.hh"
+#include "DispatchQueue.hh"
 #include "WriteSdcPvt.hh"
 
 namespace sta {
@@ -53,6 +57,13 @@ namespace sta {
 typedef Set<ClockSense*> ClockSenseSet;
 typedef Vector<ClockSense*> ClockSenseSeq;
 
+static const int stream_buffer_size = 1 << 18;
+static const size_t print_buffer_size = 512;
+
+// Section buffer for the section being formatted by this thread.
+// When null, print writes directly to the stream.
+static thread_local string *section_buffer_ = nullptr;
+
 static const char *
 transRiseFallFlag(const RiseFall *rf);
 static const char *
@@ -134,7 +145,7 @@ void
 WriteGetPinAndClkKey::write() const
 {
   writer_->writeClockKey(clk_);
-  gzprintf(writer_->stream(), " ");
+  writer_->print(" ");
   writer_->writeGetPin(pin_, map_hpin_to_drvr_);
 }
 
@@ -278,10 +289,12 @@ writeSdc(Instance *instance,
 	 int digits,
          bool gzip,
 	 bool no_timestamp,
+	 bool collapse_buses,
 	 Sdc *sdc)
 {
   WriteSdc writer(instance, creator, map_hpins, native,
 		  digits, no_timestamp, sdc);
+  writer.setCollapseBuses(collapse_buses);
   writer.write(filename, gzip);
 }
 
@@ -299,6 +312,7 @@ WriteSdc::WriteSdc(Instance *instance,
   native_(native),
   digits_(digits),
   no_timestamp_(no_timestamp),
+  collapse_buses_(false),
   top_instance_(instance == sdc_network_->topInstance()),
   instance_name_length_(strlen(sdc_network_->pathName(instance))),
   cell_(sdc_network_->cell(instance))
@@ -309,19 +323,121 @@ WriteSdc::~WriteSdc()
 {
 }
 
+void
+WriteSdc::setCollapseBuses(bool collapse_buses)
+{
+  collapse_buses_ = collapse_buses;
+}
+
 void
 WriteSdc::write(const char *filename,
                 bool gzip)
 {
   openFile(filename, gzip);
   writeHeader();
-  writeTiming();
-  writeEnvironment();
-  writeDesignRules();
-  writeVariables();
+  WriteSdcSectionSeq sections;
+  findSections(sections);
+  if (thread_count_ == 1) {
+    for (WriteSdcSection section : sections)
+      (this->*section)();
+  }
+  else
+    writeSectionsParallel(sections);
   closeFile();
 }
 
+// Sections in the order they are written.
+void
+WriteSdc::findSections(WriteSdcSectionSeq &sections) const
+{
+  sections.push_back(&WriteSdc::writeTimingComment);
+  sections.push_back(&WriteSdc::writeClocks);
+  sections.push_back(&WriteSdc::writePropagatedClkPins);
+  sections.push_back(&WriteSdc::writeClockUncertaintyPins);
+  sections.push_back(&WriteSdc::writeClockLatencies);
+  sections.push_back(&WriteSdc::writeClockInsertions);
+  sections.push_back(&WriteSdc::writeInterClockUncertainties);
+  sections.push_back(&WriteSdc::writeClockSenses);
+  sections.push_back(&WriteSdc::writeClockGroups);
+  sections.push_back(&WriteSdc::writeInputDelays);
+  sections.push_back(&WriteSdc::writeOutputDelays);
+  sections.push_back(&WriteSdc::writeDisables);
+  sections.push_back(&WriteSdc::writeExceptions);
+  sections.push_back(&WriteSdc::writeDataChecks);
+
+  sections.push_back(&WriteSdc::writeEnvironmentComment);
+  sections.push_back(&WriteSdc::writeOperatingConditions);
+  sections.push_back(&WriteSdc::writeWireload);
+  sections.push_back(&WriteSdc::writePortLoads);
+  sections.push_back(&WriteSdc::writeNetLoads);
+  sections.push_back(&WriteSdc::writeDriveResistances);
+  sections.push_back(&WriteSdc::writeDrivingCells);
+  sections.push_back(&WriteSdc::writeInputTransitions);
+  sections.push_back(&WriteSdc::writeNetResistances);
+  sections.push_back(&WriteSdc::writeConstants);
+  sections.push_back(&WriteSdc::writeCaseAnalysis);
+  sections.push_back(&WriteSdc::writeDeratings);
+
+  sections.push_back(&WriteSdc::writeDesignRulesComment);
+  sections.push_back(&WriteSdc::writeMinPulseWidths);
+  sections.push_back(&WriteSdc::writeLatchBorowLimits);
+  sections.push_back(&WriteSdc::writeSlewLimits);
+  sections.push_back(&WriteSdc::writeCapLimits);
+  sections.push_back(&WriteSdc::writeFanoutLimits);
+  sections.push_back(&WriteSdc::writeMaxArea);
+
+  sections.push_back(&WriteSdc::writeVariables);
+}
+
+// Each section prints into its own buffer on a worker thread.
+// The buffers are written to the file in section order so the
+// output is identical to the single threaded writer.
+void
+WriteSdc::writeSectionsParallel(const WriteSdcSectionSeq &sections) const
+{
+  size_t section_count = sections.size();
+  std::vector<string> buffers(section_count);
+  for (size_t i = 0; i < section_count; i++) {
+    dispatch_queue_->dispatch([this, &sections, &buffers, i] (int) {
+      section_buffer_ = &buffers[i];
+      (this->*sections[i])();
+      section_buffer_ = nullptr;
+    });
+  }
+  dispatch_queue_->finishTasks();
+  for (const string &buffer : buffers) {
+    if (!buffer.empty())
+      gzwrite(stream_, buffer.data(), buffer.size());
+  }
+}
+
+void
+WriteSdc::print(const char *fmt,
+                ...) const
+{
+  va_list args;
+  va_start(args, fmt);
+  if (section_buffer_) {
+    char buffer[print_buffer_size];
+    va_list args_copy;
+    va_copy(args_copy, args);
+    // Returned length does NOT include trailing '\0'.
+    size_t length = vsnprint(buffer, print_buffer_size, fmt, args_copy);
+    va_end(args_copy);
+    if (length < print_buffer_size)
+      section_buffer_->append(buffer, length);
+    else {
+      size_t start = section_buffer_->size();
+      section_buffer_->resize(start + length + 1);
+      vsnprint(&(*section_buffer_)[start], length + 1, fmt, args);
+      section_buffer_->resize(start + length);
+    }
+  }
+  else
+    gzvprintf(stream_, fmt, args);
+  va_end(args);
+}
+
 void
 WriteSdc::openFile(const char *filename,
                    bool gzip)
@@ -329,6 +445,8 @@ WriteSdc::openFile(const char *filename,
   stream_ = gzopen(filename, gzip ? "wb" : "wT");
   if (stream_ == nullptr)
     throw FileNotWritable(filename);
+  // Constraints are written with many small prints.
+  gzbuffer(stream_, stream_buffer_size);
 }
 
 void
@@ -341,39 +459,26 @@ void
 WriteSdc::writeHeader() const
 {
   writeCommentSeparator();
-  gzprintf(stream_, "# Created by %s\n", creator_);
+  print("# Created by %s\n", creator_);
   if (!no_timestamp_) {
     time_t now;
     time(&now);
     char *time_str = ctime(&now);
     // Remove trailing \n.
     time_str[strlen(time_str) - 1] = '\0';
-    gzprintf(stream_, "# %s\n", time_str);
+    print("# %s\n", time_str);
   }
   writeCommentSeparator();
 
-  gzprintf(stream_, "current_design %s\n", sdc_network_->name(cell_));
+  print("current_design %s\n", sdc_network_->name(cell_));
 }
 
 ////////////////////////////////////////////////////////////////
 
 void
-WriteSdc::writeTiming() const
+WriteSdc::writeTimingComment() const
 {
   writeCommentSection("Timing Constraints");
-  writeClocks();
-  writePropagatedClkPins();
-  writeClockUncertaintyPins();
-  writeClockLatencies();
-  writeClockInsertions();
-  writeInterClockUncertainties();
-  writeClockSenses();
-  writeClockGroups();
-  writeInputDelays();
-  writeOutputDelays();
-  writeDisables();
-  writeExceptions();
-  writeDataChecks();
 }
 
 void
@@ -389,9 +494,9 @@ WriteSdc::writeClocks() const
     writeClockSlews(clk);
     writeClockUncertainty(clk);
     if (clk->isPropagated()) {
-      gzprintf(stream_, "set_propagated_clock ");
+      print("set_propagated_clock ");
       writeGetClock(clk);
-      gzprintf(stream_, "\n");
+      print("\n");
     }
   }
 }
@@ -399,79 +504,79 @@ WriteSdc::writeClocks() const
 void
 WriteSdc::writeClock(Clock *clk) const
 {
-  gzprintf(stream_, "create_clock -name %s",
-	  clk->name());
+  print("create_clock -name %s",
+	clk->name());
   if (clk->addToPins())
-    gzprintf(stream_, " -add");
-  gzprintf(stream_, " -period ");
+    print(" -add");
+  print(" -period ");
   float period = clk->period();
   writeTime(period);
   FloatSeq *waveform = clk->waveform();
   if (!(waveform->size() == 2
         && (*waveform)[0] == 0.0
         && fuzzyEqual((*waveform)[1], period / 2.0))) {
-    gzprintf(stream_, " -waveform ");
+    print(" -waveform ");
     writeFloatSeq(waveform, scaleTime(1.0));
   }
   writeCmdComment(clk);
-  gzprintf(stream_, " ");
+  print(" ");
   writeClockPins(clk);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
 WriteSdc::writeGeneratedClock(Clock *clk) const
 {
-  gzprintf(stream_, "create_generated_clock -name %s",
-	  clk->name());
+  print("create_generated_clock -name %s",
+	clk->name());
   if (clk->addToPins())
-    gzprintf(stream_, " -add");
-  gzprintf(stream_, " -source ");
+    print(" -add");
+  print(" -source ");
   writeGetPin(clk->srcPin(), true);
   Clock *master = clk->masterClk();
   if (master && !clk->masterClkInfered()) {
-    gzprintf(stream_, " -master_clock ");
+    print(" -master_clock ");
     writeGetClock(master);
   }
   Pin *pll_out = clk->pllOut();
   if (pll_out) {
-    gzprintf(stream_, " -pll_out ");
+    print(" -pll_out ");
     writeGetPin(pll_out, true);
   }
   Pin *pll_fdbk = clk->pllFdbk();
   if (pll_fdbk) {
-    gzprintf(stream_, " -pll_feedback ");
+    print(" -pll_feedback ");
     writeGetPin(pll_fdbk, false);
   }
   if (clk->combinational())
-    gzprintf(stream_, " -combinational");
+    print(" -combinational");
   int divide_by = clk->divideBy();
   if (divide_by != 0)
-    gzprintf(stream_, " -divide_by %d", divide_by);
+    print(" -divide_by %d", divide_by);
   int multiply_by = clk->multiplyBy();
   if (multiply_by != 0)
-    gzprintf(stream_, " -multiply_by %d", multiply_by);
+    print(" -multiply_by %d", multiply_by);
   float duty_cycle = clk->dutyCycle();
   if (duty_cycle != 0.0) {
-    gzprintf(stream_, " -duty_cycle ");
+    print(" -duty_cycle ");
     writeFloat(duty_cycle);
   }
   if (clk->invert())
-    gzprintf(stream_, " -invert");
+    print(" -invert");
   IntSeq *edges = clk->edges();
   if (edges && !edges->empty()) {
-    gzprintf(stream_, " -edges ");
+    print(" -edges ");
     writeIntSeq(edges);
     FloatSeq *edge_shifts = clk->edgeShifts();
     if (edge_shifts && !edge_shifts->empty()) {
-      gzprintf(stream_, " -edge_shift ");
+      print(" -edge_shift ");
       writeFloatSeq(edge_shifts, scaleTime(1.0));
     }
   }
   writeCmdComment(clk);
-  gzprintf(stream_, " ");
+  print(" ");
   writeClockPins(clk);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
@@ -481,7 +586,7 @@ WriteSdc::writeClockPins(Clock *clk) const
   PinSet &pins = clk->pins();
   if (!pins.empty()) {
     if (pins.size() > 1)
-      gzprintf(stream_, "\\\n    ");
+      print("\\\n    ");
     writeGetPins(&pins, true);
   }
 }
@@ -519,9 +624,9 @@ WriteSdc::writeClockUncertainty(Clock *clk,
 				const char *setup_hold,
 				float value) const
 {
-  gzprintf(stream_, "set_clock_uncertainty %s", setup_hold);
+  print("set_clock_uncertainty %s", setup_hold);
   writeTime(value);
-  gzprintf(stream_, " %s\n", clk->name());
+  print(" %s\n", clk->name());
 }
 
 void
@@ -561,11 +666,11 @@ WriteSdc::writeClockUncertaintyPin(const Pin *pin,
 				   const char *setup_hold,
 				   float value) const
 {
-  gzprintf(stream_, "set_clock_uncertainty %s", setup_hold);
+  print("set_clock_uncertainty %s", setup_hold);
   writeTime(value);
-  gzprintf(stream_, " ");
+  print(" ");
   writeGetPin(pin, true);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
@@ -640,9 +745,9 @@ WriteSdc::writePropagatedClkPins() const
   PinSet::Iterator pin_iter(sdc_->propagated_clk_pins_);
   while (pin_iter.hasNext()) {
     const Pin *pin = pin_iter.next();
-    gzprintf(stream_, "set_propagated_clock ");
+    print("set_propagated_clock ");
     writeGetPin(pin, true);
-    gzprintf(stream_, "\n");
+    print("\n");
   }
 }
 
@@ -670,13 +775,13 @@ writeInterClockUncertainty(InterClockUncertainty *uncertainty) const
   float value;
   if (src_rise->equal(src_fall)
       && src_rise->isOneValue(value)) {
-    gzprintf(stream_, "set_clock_uncertainty -from ");
+    print("set_clock_uncertainty -from ");
     writeGetClock(src_clk);
-    gzprintf(stream_, " -to ");
+    print(" -to ");
     writeGetClock(tgt_clk);
-    gzprintf(stream_, " ");
+    print(" ");
     writeTime(value);
-    gzprintf(stream_, "\n");
+    print("\n");
   }
   else {
     for (auto src_rf : RiseFall::range()) {
@@ -687,16 +792,16 @@ writeInterClockUncertainty(InterClockUncertainty *uncertainty) const
 	  sdc_->clockUncertainty(src_clk, src_rf, tgt_clk, tgt_rf,
 					 setup_hold, value, exists);
 	  if (exists) {
-	    gzprintf(stream_, "set_clock_uncertainty -%s_from ",
-		    src_rf == RiseFall::rise() ? "rise" : "fall");
+	    print("set_clock_uncertainty -%s_from ",
+		  src_rf == RiseFall::rise() ? "rise" : "fall");
 	    writeGetClock(uncertainty->src());
-	    gzprintf(stream_, " -%s_to ",
-		    tgt_rf == RiseFall::rise() ? "rise" : "fall");
+	    print(" -%s_to ",
+		  tgt_rf == RiseFall::rise() ? "rise" : "fall");
 	    writeGetClock(uncertainty->target());
-	    gzprintf(stream_, " %s ",
-		    setupHoldFlag(setup_hold));
+	    print(" %s ",
+		  setupHoldFlag(setup_hold));
 	    writeTime(value);
-	    gzprintf(stream_, "\n");
+	    print("\n");
 	  }
 	}
       }
@@ -812,25 +917,25 @@ WriteSdc::writePortDelay(PortDelay *port_delay,
 			 const MinMaxAll *min_max,
 			 const char *sdc_cmd) const
 {
-  gzprintf(stream_, "%s ", sdc_cmd);
+  print("%s ", sdc_cmd);
   writeTime(delay);
   ClockEdge *clk_edge = port_delay->clkEdge();
   if (clk_edge) {
     writeClockKey(clk_edge->clock());
     if (clk_edge->transition() == RiseFall::fall())
-      gzprintf(stream_, " -clock_fall");
+      print(" -clock_fall");
   }
-  gzprintf(stream_, "%s%s -add_delay ",
-	  transRiseFallFlag(rf),
-	  minMaxFlag(min_max));
+  print("%s%s -add_delay ",
+	transRiseFallFlag(rf),
+	minMaxFlag(min_max));
   Pin *ref_pin = port_delay->refPin();
   if (ref_pin) {
-    gzprintf(stream_, "-reference_pin ");
+    print("-reference_pin ");
     writeGetPin(ref_pin, true);
-    gzprintf(stream_, " ");
+    print(" ");
   }
   writeGetPin(port_delay->pin(), is_input_delay);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 class PinClockPairNameLess
@@ -894,15 +999,15 @@ WriteSdc::writeClockSense(PinClockPair &pin_clk,
     flag = "-negative";
   else if (sense == ClockSense::stop)
     flag = "-stop_propagation";
-  gzprintf(stream_, "set_sense -type clock %s ", flag);
+  print("set_sense -type clock %s ", flag);
   const Clock *clk = pin_clk.second;
   if (clk) {
-    gzprintf(stream_, "-clock ");
+    print("-clock ");
     writeGetClock(clk);
-    gzprintf(stream_, " ");
+    print(" ");
   }
   writeGetPin(pin_clk.first, true);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 class ClockGroupLess
@@ -966,15 +1071,15 @@ WriteSdc::writeClockGroups() const
 void
 WriteSdc::writeClockGroups(ClockGroups *clk_groups) const
 {
-  gzprintf(stream_, "set_clock_groups -name %s ", clk_groups->name());
+  print("set_clock_groups -name %s ", clk_groups->name());
   if (clk_groups->logicallyExclusive())
-    gzprintf(stream_, "-logically_exclusive \\\n");
+    print("-logically_exclusive \\\n");
   else if (clk_groups->physicallyExclusive())
-    gzprintf(stream_, "-physically_exclusive \\\n");
+    print("-physically_exclusive \\\n");
   else if (clk_groups->asynchronous())
-    gzprintf(stream_, "-asynchronous \\\n");
+    print("-asynchronous \\\n");
   if (clk_groups->allowPaths())
-    gzprintf(stream_, "-allow_paths \\\n");
+    print("-allow_paths \\\n");
   Vector<ClockGroup*> groups;
   ClockGroupSet::Iterator group_iter1(clk_groups->groups());
   while (group_iter1.hasNext()) {
@@ -987,13 +1092,13 @@ WriteSdc::writeClockGroups(ClockGroups *clk_groups) const
   while (group_iter2.hasNext()) {
     ClockGroup *clk_group = group_iter2.next();
     if (!first)
-      gzprintf(stream_, "\\\n");
-    gzprintf(stream_, " -group ");
+      print("\\\n");
+    print(" -group ");
     writeGetClocks(clk_group->clks());
     first = false;
   }
   writeCmdComment(clk_groups);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1019,9 +1124,9 @@ WriteSdc::writeDisabledCells() const
     DisabledCellPorts *disable = disabled_iter.next();
     LibertyCell *cell = disable->cell();
     if (disable->all()) {
-      gzprintf(stream_, "set_disable_timing ");
+      print("set_disable_timing ");
       writeGetLibCell(cell);
-      gzprintf(stream_, "\n");
+      print("\n");
     }
     if (disable->fromTo()) {
       LibertyPortPairSeq pairs;
@@ -1031,11 +1136,11 @@ WriteSdc::writeDisabledCells() const
 	LibertyPortPair *from_to = pair_iter.next();
 	const LibertyPort *from = from_to->first;
 	const LibertyPort *to = from_to->second;
-	gzprintf(stream_, "set_disable_timing -from {%s} -to {%s} ",
-		from->name(),
-		to->name());
+	print("set_disable_timing -from {%s} -to {%s} ",
+	      from->name(),
+	      to->name());
 	writeGetLibCell(cell);
-	gzprintf(stream_, "\n");
+	print("\n");
       }
     }
     if (disable->from()) {
@@ -1044,10 +1149,10 @@ WriteSdc::writeDisabledCells() const
       LibertyPortSeq::Iterator from_iter(from);
       while (from_iter.hasNext()) {
 	LibertyPort *from_port = from_iter.next();
-	gzprintf(stream_, "set_disable_timing -from {%s} ",
-		from_port->name());
+	print("set_disable_timing -from {%s} ",
+	      from_port->name());
 	writeGetLibCell(cell);
-	gzprintf(stream_, "\n");
+	print("\n");
       }
     }
     if (disable->to()) {
@@ -1056,18 +1161,18 @@ WriteSdc::writeDisabledCells() const
       LibertyPortSeq::Iterator to_iter(to);
       while (to_iter.hasNext()) {
 	LibertyPort *to_port = to_iter.next();
-	gzprintf(stream_, "set_disable_timing -to {%s} ",
-		to_port->name());
+	print("set_disable_timing -to {%s} ",
+	      to_port->name());
 	writeGetLibCell(cell);
-	gzprintf(stream_, "\n");
+	print("\n");
       }
     }
     if (disable->timingArcSets()) {
       // The only syntax to disable timing arc sets disables all of the
       // cell's timing arc sets.
-      gzprintf(stream_, "set_disable_timing ");
+      print("set_disable_timing ");
       writeGetTimingArcsOfOjbects(cell);
-      gzprintf(stream_, "\n");
+      print("\n");
     }
   }
 }
@@ -1080,9 +1185,9 @@ WriteSdc::writeDisabledPorts() const
   PortSeq::Iterator port_iter(ports);
   while (port_iter.hasNext()) {
     Port *port = port_iter.next();
-    gzprintf(stream_, "set_disable_timing ");
+    print("set_disable_timing ");
     writeGetPort(port);
-    gzprintf(stream_, "\n");
+    print("\n");
   }
 }
 
@@ -1094,9 +1199,9 @@ WriteSdc::writeDisabledLibPorts() const
   LibertyPortSeq::Iterator port_iter(ports);
   while (port_iter.hasNext()) {
     LibertyPort *port = port_iter.next();
-    gzprintf(stream_, "set_disable_timing ");
+    print("set_disable_timing ");
     writeGetLibPin(port);
-    gzprintf(stream_, "\n");
+    print("\n");
   }
 }
 
@@ -1111,9 +1216,9 @@ WriteSdc::writeDisabledInstances() const
     DisabledInstancePorts *disable = disabled_iter.next();
     Instance *inst = disable->instance();
     if (disable->all()) {
-      gzprintf(stream_, "set_disable_timing ");
+      print("set_disable_timing ");
       writeGetInstance(inst);
-      gzprintf(stream_, "\n");
+      print("\n");
     }
     else if (disable->fromTo()) {
       LibertyPortPairSeq pairs;
@@ -1123,11 +1228,11 @@ WriteSdc::writeDisabledInstances() const
 	LibertyPortPair *from_to = pair_iter.next();
 	const LibertyPort *from_port = from_to->first;
 	const LibertyPort *to_port = from_to->second;
-	gzprintf(stream_, "set_disable_timing -from {%s} -to {%s} ",
-		from_port->name(),
-		to_port->name());
+	print("set_disable_timing -from {%s} -to {%s} ",
+	      from_port->name(),
+	      to_port->name());
 	writeGetInstance(inst);
-	gzprintf(stream_, "\n");
+	print("\n");
       }
     }
     if (disable->from()) {
@@ -1136,10 +1241,10 @@ WriteSdc::writeDisabledInstances() const
       LibertyPortSeq::Iterator from_iter(from);
       while (from_iter.hasNext()) {
 	LibertyPort *from_port = from_iter.next();
-	gzprintf(stream_, "set_disable_timing -from {%s} ",
-		from_port->name());
+	print("set_disable_timing -from {%s} ",
+	      from_port->name());
 	writeGetInstance(inst);
-	gzprintf(stream_, "\n");
+	print("\n");
       }
     }
     if (disable->to()) {
@@ -1148,10 +1253,10 @@ WriteSdc::writeDisabledInstances() const
       LibertyPortSeq::Iterator to_iter(to);
       while (to_iter.hasNext()) {
 	LibertyPort *to_port = to_iter.next();
-	gzprintf(stream_, "set_disable_timing -to {%s} ",
-		to_port->name());
+	print("set_disable_timing -to {%s} ",
+	      to_port->name());
 	writeGetInstance(inst);
-	gzprintf(stream_, "\n");
+	print("\n");
       }
     }
   }
@@ -1165,9 +1270,9 @@ WriteSdc::writeDisabledPins() const
   PinSeq::Iterator pin_iter(pins);
   while (pin_iter.hasNext()) {
     Pin *pin = pin_iter.next();
-    gzprintf(stream_, "set_disable_timing ");
+    print("set_disable_timing ");
     writeGetPin(pin, false);
-    gzprintf(stream_, "\n");
+    print("\n");
   }
 }
 
@@ -1225,20 +1330,20 @@ WriteSdc::edgeSenseIsUnique(Edge *edge,
 void
 WriteSdc::writeDisabledEdge(Edge *edge) const
 {
-  gzprintf(stream_, "set_disable_timing ");
+  print("set_disable_timing ");
   writeGetTimingArcs(edge);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
 WriteSdc::writeDisabledEdgeSense(Edge *edge) const
 {
-  gzprintf(stream_, "set_disable_timing ");
+  print("set_disable_timing ");
   const char *sense = timingSenseString(edge->sense());
   string filter;
   stringPrint(filter, "sense == %s", sense);
   writeGetTimingArcs(edge, filter.c_str());
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1274,44 +1379,44 @@ WriteSdc::writeException(ExceptionPath *exception) const
     writeExceptionTo(exception->to());
   writeExceptionValue(exception);
   writeCmdComment(exception);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
 WriteSdc::writeExceptionCmd(ExceptionPath *exception) const
 {
   if (exception->isFalse()) {
-    gzprintf(stream_, "set_false_path");
+    print("set_false_path");
     writeSetupHoldFlag(exception->minMax());
   }
   else if (exception->isMultiCycle()) {
-    gzprintf(stream_, "set_multicycle_path");
+    print("set_multicycle_path");
     const MinMaxAll *min_max = exception->minMax();
     writeSetupHoldFlag(min_max);
     if (min_max == MinMaxAll::min()) {
       // For hold MCPs default is -start.
       if (exception->useEndClk())
-	gzprintf(stream_, " -end");
+	print(" -end");
     }
     else {
       // For setup MCPs default is -end.
       if (!exception->useEndClk())
-	gzprintf(stream_, " -start");
+	print(" -start");
     }
   }
   else if (exception->isPathDelay()) {
     if (exception->minMax() == MinMaxAll::max())
-      gzprintf(stream_, "set_max_delay");
+      print("set_max_delay");
     else
-      gzprintf(stream_, "set_min_delay");
+      print("set_min_delay");
     if (exception->ignoreClkLatency())
-      gzprintf(stream_, " -ignore_clock_latency");
+      print(" -ignore_clock_latency");
   }
   else if (exception->isGroupPath()) {
     if (exception->isDefault())
-      gzprintf(stream_, "group_path -default");
+      print("group_path -default");
     else
-      gzprintf(stream_, "group_path -name %s", exception->name());
+      print("group_path -name %s", exception->name());
   }
   else
     report_->critical(214, "unknown exception type");
@@ -1321,10 +1426,10 @@ void
 WriteSdc::writeExceptionValue(ExceptionPath *exception) const
 {
   if (exception->isMultiCycle())
-    gzprintf(stream_, " %d",
-	    exception->pathMultiplier());
+    print(" %d",
+	  exception->pathMultiplier());
   else if (exception->isPathDelay()) {
-    gzprintf(stream_, " ");
+    print(" ");
     writeTime(exception->delay());
   }
 }
@@ -1340,7 +1445,7 @@ WriteSdc::writeExceptionTo(ExceptionTo *to) const
 {
   const RiseFallBoth *end_rf = to->endTransition();
   if (end_rf != RiseFallBoth::riseFall())
-    gzprintf(stream_, "%s ", transRiseFallFlag(end_rf));
+    print("%s ", transRiseFallFlag(end_rf));
   if (to->hasObjects())
     writeExceptionFromTo(to, "to", false);
 }
@@ -1356,25 +1461,30 @@ WriteSdc::writeExceptionFromTo(ExceptionFromTo *from_to,
     rf_prefix = "-rise_";
   else if (rf == RiseFallBoth::fall())
     rf_prefix = "-fall_";
-  gzprintf(stream_, "\\\n    %s%s ", rf_prefix, from_to_key);
+  print("\\\n    %s%s ", rf_prefix, from_to_key);
+  PinSeq pins;
+  PinSet bus_pins;
+  if (from_to->pins()) {
+    sortPinSet(from_to->pins(), sdc_network_, pins);
+    collapseBusPins(pins, bus_pins);
+  }
   bool multi_objs =
-    ((from_to->pins() ? from_to->pins()->size() : 0)
+    (pins.size()
      + (from_to->clks() ? from_to->clks()->size() : 0)
      + (from_to->instances() ? from_to->instances()->size() : 0)) > 1;
   if (multi_objs)
-    gzprintf(stream_, "[list ");
+    print("[list ");
   bool first = true;
-  if (from_to->pins()) {
-    PinSeq pins;
-    sortPinSet(from_to->pins(), sdc_network_, pins);
-    PinSeq::Iterator pin_iter(pins);
-    while (pin_iter.hasNext()) {
-      Pin *pin = pin_iter.next();
-      if (multi_objs && !first)
-	gzprintf(stream_, "\\\n           ");
+  PinSeq::Iterator pin_iter(pins);
+  while (pin_iter.hasNext()) {
+    Pin *pin = pin_iter.next();
+    if (multi_objs && !first)
+      print("\\\n           ");
+    if (bus_pins.hasKey(pin))
+      writeGetBusPins(pin);
+    else
       writeGetPin(pin, map_hpin_to_drvr);
-      first = false;
-    }
+    first = false;
   }
   if (from_to->clks())
     writeGetClocks(from_to->clks(), multi_objs, first);
@@ -1385,13 +1495,13 @@ WriteSdc::writeExceptionFromTo(ExceptionFromTo *from_to,
     while (inst_iter.hasNext()) {
       Instance *inst = inst_iter.next();
       if (multi_objs && !first)
-	gzprintf(stream_, "\\\n           ");
+	print("\\\n           ");
       writeGetInstance(inst);
       first = false;
     }
   }
   if (multi_objs)
-    gzprintf(stream_, "]");
+    print("]");
 }
 
 void
@@ -1403,23 +1513,28 @@ WriteSdc::writeExceptionThru(ExceptionThru *thru) const
     rf_prefix = "-rise_";
   else if (rf == RiseFallBoth::fall())
     rf_prefix = "-fall_";
-  gzprintf(stream_, "\\\n    %sthrough ", rf_prefix);
+  print("\\\n    %sthrough ", rf_prefix);
   PinSeq pins;
   mapThruHpins(thru, pins);
+  sort(pins, PinPathNameLess(network_));
+  PinSet bus_pins;
+  collapseBusPins(pins, bus_pins);
   bool multi_objs =
     (pins.size()
      + (thru->nets() ? thru->nets()->size() : 0)
      + (thru->instances() ? thru->instances()->size() : 0)) > 1;
   if (multi_objs)
-    gzprintf(stream_, "[list ");
+    print("[list ");
   bool first = true;
-  sort(pins, PinPathNameLess(network_));
   PinSeq::Iterator pin_iter(pins);
   while (pin_iter.hasNext()) {
     Pin *pin = pin_iter.next();
     if (multi_objs && !first)
-      gzprintf(stream_, "\\\n           ");
-    writeGetPin(pin);
+      print("\\\n           ");
+    if (bus_pins.hasKey(pin))
+      writeGetBusPins(pin);
+    else
+      writeGetPin(pin);
     first = false;
   }
 
@@ -1430,7 +1545,7 @@ WriteSdc::writeExceptionThru(ExceptionThru *thru) const
     while (net_iter.hasNext()) {
       Net *net = net_iter.next();
       if (multi_objs && !first)
-	gzprintf(stream_, "\\\n           ");
+	print("\\\n           ");
       writeGetNet(net);
       first = false;
     }
@@ -1442,13 +1557,13 @@ WriteSdc::writeExceptionThru(ExceptionThru *thru) const
     while (inst_iter.hasNext()) {
       Instance *inst = inst_iter.next();
       if (multi_objs && !first)
-	gzprintf(stream_, "\\\n           ");
+	print("\\\n           ");
       writeGetInstance(inst);
       first = false;
     }
   }
   if (multi_objs)
-    gzprintf(stream_, "]");
+    print("]");
 }
 
 void
@@ -1540,38 +1655,27 @@ WriteSdc::writeDataCheck(DataCheck *check,
     from_key = "-rise_from";
   else if (from_rf == RiseFallBoth::fall())
     from_key = "-fall_from";
-  gzprintf(stream_, "set_data_check %s ", from_key);
+  print("set_data_check %s ", from_key);
   writeGetPin(check->from(), true);
   const char *to_key = "-to";
   if (to_rf == RiseFallBoth::rise())
     to_key = "-rise_to";
   else if (to_rf == RiseFallBoth::fall())
     to_key = "-fall_to";
-  gzprintf(stream_, " %s ", to_key);
+  print(" %s ", to_key);
   writeGetPin(check->to(), false);
-  gzprintf(stream_, "%s ",
-	  setupHoldFlag(setup_hold));
+  print("%s ",
+	setupHoldFlag(setup_hold));
   writeTime(margin);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 ////////////////////////////////////////////////////////////////
 
 void
-WriteSdc::writeEnvironment() const
+WriteSdc::writeEnvironmentComment() const
 {
   writeCommentSection("Environment");
-  writeOperatingConditions();
-  writeWireload();
-  writePortLoads();
-  writeNetLoads();
-  writeDriveResistances();
-  writeDrivingCells();
-  writeInputTransitions();
-  writeNetResistances();
-  writeConstants();
-  writeCaseAnalysis();
-  writeDeratings();
 }
 
 void
@@ -1579,7 +1683,7 @@ WriteSdc::writeOperatingConditions() const
 {
   OperatingConditions *cond = sdc_->operatingConditions(MinMax::max());
   if (cond)
-    gzprintf(stream_, "set_operating_conditions %s\n", cond->name());
+    print("set_operating_conditions %s\n", cond->name());
 }
 
 void
@@ -1587,8 +1691,8 @@ WriteSdc::writeWireload() const
 {
   WireloadMode wireload_mode = sdc_->wireloadMode();
   if (wireload_mode != WireloadMode::unknown)
-    gzprintf(stream_, "set_wire_load_mode \"%s\"\n",
-	    wireloadModeString(wireload_mode));
+    print("set_wire_load_mode \"%s\"\n",
+	  wireloadModeString(wireload_mode));
 }
 
 void
@@ -1620,12 +1724,12 @@ WriteSdc::writeNetLoad(Net *net,
 		       const MinMaxAll *min_max,
 		       float cap) const
 {
-  gzprintf(stream_, "set_load ");
-  gzprintf(stream_, "%s ", minMaxFlag(min_max));
+  print("set_load ");
+  print("%s ", minMaxFlag(min_max));
   writeCapacitance(cap);
-  gzprintf(stream_, " ");
+  print(" ");
   writeGetNet(net);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
@@ -1669,12 +1773,12 @@ WriteSdc::writeDriveResistances() const
 	  float res;
 	  bool exists;
 	  drive->driveResistance(rf, MinMax::max(), res, exists);
-	  gzprintf(stream_, "set_drive %s ",
-		  transRiseFallFlag(rf));
+	  print("set_drive %s ",
+		transRiseFallFlag(rf));
 	  writeResistance(res);
-	  gzprintf(stream_, " ");
+	  print(" ");
 	  writeGetPort(port);
-	  gzprintf(stream_, "\n");
+	  print("\n");
 	}
 	else {
 	  for (auto min_max : MinMax::range()) {
@@ -1682,13 +1786,13 @@ WriteSdc::writeDriveResistances() const
 	    bool exists;
 	    drive->driveResistance(rf, min_max, res, exists);
 	    if (exists) {
-	      gzprintf(stream_, "set_drive %s %s ",
-		      transRiseFallFlag(rf),
-		      minMaxFlag(min_max));
+	      print("set_drive %s %s ",
+		    transRiseFallFlag(rf),
+		    minMaxFlag(min_max));
 	      writeResistance(res);
-	      gzprintf(stream_, " ");
+	      print(" ");
 	      writeGetPort(port);
-	      gzprintf(stream_, "\n");
+	      print("\n");
 	    }
 	  }
 	}
@@ -1765,27 +1869,26 @@ WriteSdc::writeDrivingCell(Port *port,
   LibertyPort *to_port = drive_cell->toPort();
   float *from_slews = drive_cell->fromSlews();
   LibertyLibrary *lib = drive_cell->library();
-  gzprintf(stream_, "set_driving_cell");
+  print("set_driving_cell");
   if (rf)
-    gzprintf(stream_, " %s", transRiseFallFlag(rf));
+    print(" %s", transRiseFallFlag(rf));
   if (min_max)
-    gzprintf(stream_, " %s", minMaxFlag(min_max));
+    print(" %s", minMaxFlag(min_max));
   // Only write -library if it was specified in the sdc.
   if (lib)
-    gzprintf(stream_, " -library %s", lib->name());
-  gzprintf(stream_, " -lib_cell %s", cell->name());
+    print(" -library %s", lib->name());
+  print(" -lib_cell %s", cell->name());
   if (from_port)
-    gzprintf(stream_, " -from_pin {%s}",
-	    from_port->name());
-  gzprintf(stream_,
-	  " -pin {%s} -input_transition_rise ",
-	  to_port->name());
+    print(" -from_pin {%s}",
+	  from_port->name());
+  print(" -pin {%s} -input_transition_rise ",
+	to_port->name());
   writeTime(from_slews[RiseFall::riseIndex()]);
-  gzprintf(stream_, " -input_transition_fall ");
+  print(" -input_transition_fall ");
   writeTime(from_slews[RiseFall::fallIndex()]);
-  gzprintf(stream_, " ");
+  print(" ");
   writeGetPort(port);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
@@ -1841,11 +1944,11 @@ WriteSdc::writeNetResistance(Net *net,
 			     const MinMaxAll *min_max,
 			     float res) const
 {
-  gzprintf(stream_, "set_resistance ");
+  print("set_resistance ");
   writeResistance(res);
-  gzprintf(stream_, "%s ", minMaxFlag(min_max));
+  print("%s ", minMaxFlag(min_max));
   writeGetNet(net);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
@@ -1864,9 +1967,9 @@ void
 WriteSdc::writeConstant(Pin *pin) const
 {
   const char *cmd = setConstantCmd(pin);
-  gzprintf(stream_, "%s ", cmd);
+  print("%s ", cmd);
   writeGetPin(pin, false);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 const char *
@@ -1907,9 +2010,9 @@ void
 WriteSdc::writeCaseAnalysis(Pin *pin) const
 {
   const char *value_str = caseAnalysisValueStr(pin);
-  gzprintf(stream_, "set_case_analysis %s ", value_str);
+  print("set_case_analysis %s ", value_str);
   writeGetPin(pin, false);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 const char *
@@ -2010,9 +2113,9 @@ WriteSdc::writeDerating(DeratingFactorsGlobal *factors) const
 	&& (!cell_check_factors->hasValue()
 	    || (check_is_one_value && check_value == 1.0))) {
       if (delay_value != 1.0) {
-	gzprintf(stream_, "set_timing_derate %s ", earlyLateFlag(early_late));
+	print("set_timing_derate %s ", earlyLateFlag(early_late));
 	writeFloat(delay_value);
-	gzprintf(stream_, "\n");
+	print("\n");
       }
     }
     else {
@@ -2051,15 +2154,15 @@ WriteSdc::writeDerating(DeratingFactors *factors,
   factors->isOneValue(early_late, is_one_value, value);
   if (is_one_value) {
     if (value != 1.0) {
-      gzprintf(stream_, "set_timing_derate %s %s ",
-	      type_key,
-	      earlyLateFlag(early_late));
+      print("set_timing_derate %s %s ",
+	    type_key,
+	    earlyLateFlag(early_late));
       writeFloat(value);
       if (write_obj) {
-	gzprintf(stream_, " ");
+	print(" ");
 	write_obj->write();
       }
-      gzprintf(stream_, "\n");
+      print("\n");
     }
   }
   else {
@@ -2072,16 +2175,16 @@ WriteSdc::writeDerating(DeratingFactors *factors,
       factors->isOneValue(clk_data, early_late, is_one_value, value);
       if (is_one_value) {
 	if (value != 1.0) {
-	  gzprintf(stream_, "set_timing_derate %s %s %s ",
-		  type_key,
-		  earlyLateFlag(early_late),
-		  clk_data_key);
+	  print("set_timing_derate %s %s %s ",
+		type_key,
+		earlyLateFlag(early_late),
+		clk_data_key);
 	  writeFloat(value);
 	  if (write_obj) {
-	    gzprintf(stream_, " ");
+	    print(" ");
 	    write_obj->write();
 	  }
-	  gzprintf(stream_, "\n");
+	  print("\n");
 	}
       }
       else {
@@ -2090,17 +2193,17 @@ WriteSdc::writeDerating(DeratingFactors *factors,
 	  bool exists;
 	  factors->factor(clk_data, rf, early_late, factor, exists);
 	  if (exists) {
-	    gzprintf(stream_, "set_timing_derate %s %s %s %s ",
-		    type_key,
-		    clk_data_key,
-		    transRiseFallFlag(rf),
-		    earlyLateFlag(early_late));
+	    print("set_timing_derate %s %s %s %s ",
+		  type_key,
+		  clk_data_key,
+		  transRiseFallFlag(rf),
+		  earlyLateFlag(early_late));
 	    writeFloat(factor);
 	    if (write_obj) {
-	      gzprintf(stream_, " ");
+	      print(" ");
 	      write_obj->write();
 	    }
-	    gzprintf(stream_, "\n");
+	    print("\n");
 	  }
 	}
       }
@@ -2118,15 +2221,9 @@ timingDerateTypeKeyword(TimingDerateType type)
 ////////////////////////////////////////////////////////////////
 
 void
-WriteSdc::writeDesignRules() const
+WriteSdc::writeDesignRulesComment() const
 {
   writeCommentSection("Design Rules");
-  writeMinPulseWidths();
-  writeLatchBorowLimits();
-  writeSlewLimits();
-  writeCapLimits();
-  writeFanoutLimits();
-  writeMaxArea();
 }
 
 void
@@ -2185,11 +2282,11 @@ WriteSdc::writeMinPulseWidth(const char *hi_low,
 			     float value,
 			     WriteSdcObject &write_obj) const
 {
-  gzprintf(stream_, "set_min_pulse_width %s", hi_low);
+  print("set_min_pulse_width %s", hi_low);
   writeTime(value);
-  gzprintf(stream_, " ");
+  print(" ");
   write_obj.write();
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 ////////////////////////////////////////////////////////////////
@@ -2203,11 +2300,11 @@ WriteSdc::writeLatchBorowLimits() const
     const Pin *pin;
     float limit;
     pin_iter.next(pin, limit);
-    gzprintf(stream_, "set_max_time_borrow ");
+    print("set_max_time_borrow ");
     writeTime(limit);
-    gzprintf(stream_, " ");
+    print(" ");
     writeGetPin(pin, false);
-    gzprintf(stream_, "\n");
+    print("\n");
   }
   InstLatchBorrowLimitMap::Iterator
     inst_iter(sdc_->inst_latch_borrow_limit_map_);
@@ -2215,11 +2312,11 @@ WriteSdc::writeLatchBorowLimits() const
     const Instance *inst;
     float limit;
     inst_iter.next(inst, limit);
-    gzprintf(stream_, "set_max_time_borrow ");
+    print("set_max_time_borrow ");
     writeTime(limit);
-    gzprintf(stream_, " ");
+    print(" ");
     writeGetInstance(inst);
-    gzprintf(stream_, "\n");
+    print("\n");
   }
   ClockLatchBorrowLimitMap::Iterator
     clk_iter(sdc_->clk_latch_borrow_limit_map_);
@@ -2227,11 +2324,11 @@ WriteSdc::writeLatchBorowLimits() const
     const Clock *clk;
     float limit;
     clk_iter.next(clk, limit);
-    gzprintf(stream_, "set_max_time_borrow ");
+    print("set_max_time_borrow ");
     writeTime(limit);
-    gzprintf(stream_, " ");
+    print(" ");
     writeGetClock(clk);
-    gzprintf(stream_, "\n");
+    print("\n");
   }
 }
 
@@ -2245,9 +2342,9 @@ WriteSdc::writeSlewLimits() const
   bool exists;
   sdc_->slewLimit(cell_, min_max, slew, exists);
   if (exists) {
-    gzprintf(stream_, "set_max_transition ");
+    print("set_max_transition ");
     writeTime(slew);
-    gzprintf(stream_, " [current_design]\n");
+    print(" [current_design]\n");
   }
 
   CellPortBitIterator *port_iter = sdc_network_->portBitIterator(cell_);
@@ -2255,11 +2352,11 @@ WriteSdc::writeSlewLimits() const
     Port *port = port_iter->next();
     sdc_->slewLimit(port, min_max, slew, exists);
     if (exists) {
-      gzprintf(stream_, "set_max_transition ");
+      print("set_max_transition ");
       writeTime(slew);
-      gzprintf(stream_, " ");
+      print(" ");
       writeGetPort(port);
-      gzprintf(stream_, "\n");
+      print("\n");
     }
   }
   delete port_iter;
@@ -2322,11 +2419,11 @@ WriteSdc::writeClkSlewLimit(const char *clk_data,
 			    const Clock *clk,
 			    float limit) const
 {
-  gzprintf(stream_, "set_max_transition %s%s", clk_data, rise_fall);
+  print("set_max_transition %s%s", clk_data, rise_fall);
   writeTime(limit);
-  gzprintf(stream_, " ");
+  print(" ");
   writeGetClock(clk);
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
@@ -2344,9 +2441,9 @@ WriteSdc::writeCapLimits(const MinMax *min_max,
   bool exists;
   sdc_->capacitanceLimit(cell_, min_max, cap, exists);
   if (exists) {
-    gzprintf(stream_, "%s ", cmd);
+    print("%s ", cmd);
     writeCapacitance(cap);
-    gzprintf(stream_, " [current_design]\n");
+    print(" [current_design]\n");
   }
 
   PortCapLimitMap::Iterator port_iter(sdc_->port_cap_limit_map_);
@@ -2358,11 +2455,11 @@ WriteSdc::writeCapLimits(const MinMax *min_max,
     bool exists;
     values.value(min_max, cap, exists);
     if (exists) {
-      gzprintf(stream_, "%s ", cmd);
+      print("%s ", cmd);
       writeCapacitance(cap);
-      gzprintf(stream_, " ");
+      print(" ");
       writeGetPort(port);
-      gzprintf(stream_, "\n");
+      print("\n");
     }
   }
 
@@ -2375,11 +2472,11 @@ WriteSdc::writeCapLimits(const MinMax *min_max,
     bool exists;
     values.value(min_max, cap, exists);
     if (exists) {
-      gzprintf(stream_, "%s ", cmd);
+      print("%s ", cmd);
       writeCapacitance(cap);
-      gzprintf(stream_, " ");
+      print(" ");
       writeGetPin(pin, false);
-      gzprintf(stream_, "\n");
+      print("\n");
     }
   }
 }
@@ -2389,9 +2486,9 @@ WriteSdc::writeMaxArea() const
 {
   float max_area = sdc_->maxArea();
   if (max_area > 0.0) {
-    gzprintf(stream_, "set_max_area ");
+    print("set_max_area ");
     writeFloat(max_area);
-    gzprintf(stream_, "\n");
+    print("\n");
   }
 }
 
@@ -2410,9 +2507,9 @@ WriteSdc::writeFanoutLimits(const MinMax *min_max,
   bool exists;
   sdc_->fanoutLimit(cell_, min_max, fanout, exists);
   if (exists) {
-    gzprintf(stream_, "%s ", cmd);
+    print("%s ", cmd);
     writeFloat(fanout);
-    gzprintf(stream_, " [current_design]\n");
+    print(" [current_design]\n");
   }
   else {
     CellPortBitIterator *port_iter = sdc_network_->portBitIterator(cell_);
@@ -2420,11 +2517,11 @@ WriteSdc::writeFanoutLimits(const MinMax *min_max,
       Port *port = port_iter->next();
       sdc_->fanoutLimit(port, min_max, fanout, exists);
       if (exists) {
-	gzprintf(stream_, "%s ", cmd);
+	print("%s ", cmd);
 	writeFloat(fanout);
-	gzprintf(stream_, " ");
+	print(" ");
 	writeGetPort(port);
-	gzprintf(stream_, "\n");
+	print("\n");
       }
     }
     delete port_iter;
@@ -2438,15 +2535,15 @@ WriteSdc::writeVariables() const
 {
   if (sdc_->propagateAllClocks()) {
     if (native_)
-      gzprintf(stream_, "set sta_propagate_all_clocks 1\n");
+      print("set sta_propagate_all_clocks 1\n");
     else
-      gzprintf(stream_, "set timing_all_clocks_propagated true\n");
+      print("set timing_all_clocks_propagated true\n");
   }
   if (sdc_->presetClrArcsEnabled()) {
     if (native_)
-      gzprintf(stream_, "set sta_preset_clear_arcs_enabled 1\n");
+      print("set sta_preset_clear_arcs_enabled 1\n");
     else
-      gzprintf(stream_, "set timing_enable_preset_clear_arcs true\n");
+      print("set timing_enable_preset_clear_arcs true\n");
   }
 }
 
@@ -2455,9 +2552,9 @@ WriteSdc::writeVariables() const
 void
 WriteSdc::writeGetTimingArcsOfOjbects(LibertyCell *cell) const
 {
-  gzprintf(stream_, "[%s -of_objects ", getTimingArcsCmd());
+  print("[%s -of_objects ", getTimingArcsCmd());
   writeGetLibCell(cell);
-  gzprintf(stream_, "]");
+  print("]");
 }
 
 void
@@ -2470,15 +2567,15 @@ void
 WriteSdc::writeGetTimingArcs(Edge *edge,
 			     const char *filter) const
 {
-  gzprintf(stream_, "[%s -from ", getTimingArcsCmd());
+  print("[%s -from ", getTimingArcsCmd());
   Vertex *from_vertex = edge->from(graph_);
   writeGetPin(from_vertex->pin(), true);
-  gzprintf(stream_, " -to ");
+  print(" -to ");
   Vertex *to_vertex = edge->to(graph_);
   writeGetPin(to_vertex->pin(), false);
   if (filter)
-    gzprintf(stream_, " -filter {%s}", filter);
-  gzprintf(stream_, "]");
+    print(" -filter {%s}", filter);
+  print("]");
 }
 
 const char *
@@ -2492,9 +2589,9 @@ WriteSdc::getTimingArcsCmd() const
 void
 WriteSdc::writeGetLibCell(const LibertyCell *cell) const
 {
-  gzprintf(stream_, "[get_lib_cells {%s/%s}]",
-	  cell->libertyLibrary()->name(),
-	  cell->name());
+  print("[get_lib_cells {%s/%s}]",
+	cell->libertyLibrary()->name(),
+	cell->name());
 }
 
 void
@@ -2502,10 +2599,10 @@ WriteSdc::writeGetLibPin(const LibertyPort *port) const
 {
   LibertyCell *cell = port->libertyCell();
   LibertyLibrary *lib = cell->libertyLibrary();
-  gzprintf(stream_, "[get_lib_pins {%s/%s/%s}]",
-	  lib->name(),
-	  cell->name(),
-	  port->name());
+  print("[get_lib_pins {%s/%s/%s}]",
+	lib->name(),
+	cell->name(),
+	port->name());
 }
 
 void
@@ -2514,10 +2611,10 @@ WriteSdc::writeGetClocks(ClockSet *clks) const
   bool first = true;
   bool multiple = clks->size() > 1;
   if (multiple)
-    gzprintf(stream_, "[list ");
+    print("[list ");
   writeGetClocks(clks, multiple, first);
   if (multiple)
-    gzprintf(stream_, "]");
+    print("]");
 }
 
 void
@@ -2531,7 +2628,7 @@ WriteSdc::writeGetClocks(ClockSet *clks,
   while (clk_iter.hasNext()) {
     Clock *clk = clk_iter.next();
     if (multiple && !first)
-      gzprintf(stream_, "\\\n           ");
+      print("\\\n           ");
     writeGetClock(clk);
     first = false;
   }
@@ -2540,14 +2637,14 @@ WriteSdc::writeGetClocks(ClockSet *clks,
 void
 WriteSdc::writeGetClock(const Clock *clk) const
 {
-  gzprintf(stream_, "[get_clocks {%s}]",
-	  clk->name());
+  print("[get_clocks {%s}]",
+	clk->name());
 }
 
 void
 WriteSdc::writeGetPort(const Port *port) const
 {
-  gzprintf(stream_, "[get_ports {%s}]", sdc_network_->name(port));
+  print("[get_ports {%s}]", sdc_network_->name(port));
 }
 
 void
@@ -2577,29 +2674,124 @@ WriteSdc::writeGetPins(PinSet *pins,
 void
 WriteSdc::writeGetPins1(PinSeq *pins) const
 {
+  PinSet bus_pins;
+  collapseBusPins(*pins, bus_pins);
   bool multiple = pins->size() > 1;
   if (multiple)
-    gzprintf(stream_, "[list ");
-  PinSeq::Iterator pin_iter(pins);
+    print("[list ");
   bool first = true;
-  while (pin_iter.hasNext()) {
-    Pin *pin = pin_iter.next();
+  for (Pin *pin : *pins) {
     if (multiple && !first)
-      gzprintf(stream_, "\\\n          ");
-    writeGetPin(pin);
+      print("\\\n          ");
+    if (bus_pins.hasKey(pin))
+      writeGetBusPins(pin);
+    else
+      writeGetPin(pin);
     first = false;
   }
   if (multiple)
-    gzprintf(stream_, "]");
+    print("]");
+}
+
+// With -collapse_buses, replace the bits of a bus that are all in pins
+// with the first bit, which is added to bus_pins to be written as bus[*].
+void
+WriteSdc::collapseBusPins(PinSeq &pins,
+			  PinSet &bus_pins) const
+{
+  if (collapse_buses_ && pins.size() > 1) {
+    PinSet pin_set;
+    for (Pin *pin : pins)
+      pin_set.insert(pin);
+    std::set<std::pair<const Instance*, const Port*>> collapsed, partial;
+    PinSeq pins1;
+    for (Pin *pin : pins) {
+      // Hierarchical pins mapped to leaf pins are not collapsed.
+      const Port *bus_port = (map_hpins_ && network_->isHierarchical(pin))
+	? nullptr
+	: pinBusPort(pin);
+      if (bus_port) {
+	const Instance *inst = network_->instance(pin);
+	std::pair<const Instance*, const Port*> inst_bus(inst, bus_port);
+	if (collapsed.find(inst_bus) != collapsed.end())
+	  // Written by the first bit of the bus.
+	  continue;
+	else if (partial.find(inst_bus) == partial.end()) {
+	  if (hasAllBusPins(inst, bus_port, pin_set)) {
+	    collapsed.insert(inst_bus);
+	    bus_pins.insert(pin);
+	  }
+	  else
+	    partial.insert(inst_bus);
+	}
+      }
+      pins1.push_back(pin);
+    }
+    pins.swap(pins1);
+  }
+}
+
+// Write all of the bits of pin's bus port as bus[*].
+void
+WriteSdc::writeGetBusPins(const Pin *pin) const
+{
+  bool is_port = (sdc_network_->instance(pin) == instance_);
+  string name = is_port ? sdc_network_->portName(pin) : pathName(pin);
+  name.erase(name.rfind('['));
+  name += "[*]";
+  if (is_port)
+    print("[get_ports {%s}]", name.c_str());
+  else
+    print("[get_pins {%s}]", name.c_str());
+}
+
+// Return the bus port if pin is a bus bit.
+const Port *
+WriteSdc::pinBusPort(const Pin *pin) const
+{
+  const Port *bus_port = nullptr;
+  const Port *port = network_->port(pin);
+  char *bus_name;
+  int index;
+  parseBusName(network_->name(port), '[', ']', network_->pathEscape(),
+	       bus_name, index);
+  if (bus_name) {
+    const Instance *inst = network_->instance(pin);
+    Port *port1 = network_->findPort(network_->cell(inst), bus_name);
+    if (port1 && network_->isBus(port1))
+      bus_port = port1;
+    stringDelete(bus_name);
+  }
+  return bus_port;
+}
+
+bool
+WriteSdc::hasAllBusPins(const Instance *inst,
+			const Port *bus_port,
+			const PinSet &pins) const
+{
+  bool has_all = true;
+  PortMemberIterator *member_iter = network_->memberIterator(bus_port);
+  while (member_iter->hasNext()) {
+    Port *member = member_iter->next();
+    Pin *member_pin = network_->findPin(inst, member);
+    if (member_pin == nullptr
+	|| !pins.hasKey(member_pin)) {
+      has_all = false;
+      break;
+    }
+  }
+  delete member_iter;
+  return has_all;
 }
 
 void
 WriteSdc::writeGetPin(const Pin *pin) const
 {
   if (sdc_network_->instance(pin) == instance_)
-    gzprintf(stream_, "[get_ports {%s}]", sdc_network_->portName(pin));
+    print("[get_ports {%s}]", sdc_network_->portName(pin));
   else
-    gzprintf(stream_, "[get_pins {%s}]", pathName(pin));
+    print("[get_pins {%s}]", pathName(pin));
 }
 
 void
@@ -2618,13 +2810,13 @@ WriteSdc::writeGetPin(const Pin *pin,
 void
 WriteSdc::writeGetNet(const Net *net) const
 {
-  gzprintf(stream_, "[get_nets {%s}]", pathName(net));
+  print("[get_nets {%s}]", pathName(net));
 }
 
 void
 WriteSdc::writeGetInstance(const Instance *inst) const
 {
-  gzprintf(stream_, "[get_cells {%s}]", pathName(inst));
+  print("[get_cells {%s}]", pathName(inst));
 }
 
 const char *
@@ -2661,14 +2853,14 @@ void
 WriteSdc::writeCommentSection(const char *line) const
 {
   writeCommentSeparator();
-  gzprintf(stream_, "# %s\n", line);
+  print("# %s\n", line);
   writeCommentSeparator();
 }
 
 void
 WriteSdc::writeCommentSeparator() const
 {
-  gzprintf(stream_, "###############################################################################\n");
+  print("###############################################################################\n");
 }
 
 ////////////////////////////////////////////////////////////////
@@ -2766,20 +2958,20 @@ WriteSdc::writeRiseFallMinMaxCmd(const char *sdc_cmd,
 				 const MinMaxAll *min_max,
 				 WriteSdcObject &write_object) const
 {
-  gzprintf(stream_, "%s%s%s ",
-	  sdc_cmd,
-	  transRiseFallFlag(rf),
-	  minMaxFlag(min_max));
+  print("%s%s%s ",
+	sdc_cmd,
+	transRiseFallFlag(rf),
+	minMaxFlag(min_max));
   writeFloat(value / scale);
-  gzprintf(stream_, " ");
+  print(" ");
   write_object.write();
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
 WriteSdc::writeClockKey(const Clock *clk) const
 {
-  gzprintf(stream_, " -clock ");
+  print(" -clock ");
   writeGetClock(clk);
 }
 
@@ -2815,13 +3007,13 @@ WriteSdc::writeMinMaxFloatCmd(const char *sdc_cmd,
 			      const MinMaxAll *min_max,
 			      WriteSdcObject &write_object) const
 {
-  gzprintf(stream_, "%s%s ",
-	  sdc_cmd,
-	  minMaxFlag(min_max));
+  print("%s%s ",
+	sdc_cmd,
+	minMaxFlag(min_max));
   writeFloat(value / scale);
-  gzprintf(stream_, " ");
+  print(" ");
   write_object.write();
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 void
@@ -2852,12 +3044,12 @@ WriteSdc::writeMinMaxIntCmd(const char *sdc_cmd,
 			    const MinMaxAll *min_max,
 			    WriteSdcObject &write_object) const
 {
-  gzprintf(stream_, "%s%s ",
-	  sdc_cmd,
-	  minMaxFlag(min_max));
-  gzprintf(stream_, "%d ", value);
+  print("%s%s ",
+	sdc_cmd,
+	minMaxFlag(min_max));
+  print("%d ", value);
   write_object.write();
-  gzprintf(stream_, "\n");
+  print("\n");
 }
 
 ////////////////////////////////////////////////////////////////
@@ -2883,58 +3075,58 @@ WriteSdc::scaleResistance(float res) const
 void
 WriteSdc::writeFloat(float value) const
 {
-  gzprintf(stream_, "%.*f", digits_, value);
+  print("%.*f", digits_, value);
 }
 
 void
 WriteSdc::writeTime(float time) const
 {
-  gzprintf(stream_, "%.*f", digits_, scaleTime(time));
+  print("%.*f", digits_, scaleTime(time));
 }
 
 void
 WriteSdc::writeCapacitance(float cap) const
 {
-  gzprintf(stream_, "%.*f", digits_, scaleCapacitance(cap));
+  print("%.*f", digits_, scaleCapacitance(cap));
 }
 
 void
 WriteSdc::writeResistance(float res) const
 {
-  gzprintf(stream_, "%.*f", digits_, scaleResistance(res));
+  print("%.*f", digits_, scaleResistance(res));
 }
 
 void
 WriteSdc::writeFloatSeq(FloatSeq *floats,
 			float scale) const
 {
-  gzprintf(stream_, "{");
+  print("{");
   FloatSeq::ConstIterator iter(floats);
   bool first = true;
   while (iter.hasNext()) {
     float flt = iter.next();
     if (!first)
-      gzprintf(stream_, " ");
+      print(" ");
     writeFloat(flt * scale);
     first = false;
   }
-  gzprintf(stream_, "}");
+  print("}");
 }
 
 void
 WriteSdc::writeIntSeq(IntSeq *ints) const
 {
-  gzprintf(stream_, "{");
+  print("{");
   IntSeq::ConstIterator iter(ints);
   bool first = true;
   while (iter.hasNext()) {
     int i = iter.next();
     if (!first)
-      gzprintf(stream_, " ");
-    gzprintf(stream_, "%d", i);
+      print(" ");
+    print("%d", i);
     first = false;
   }
-  gzprintf(stream_, "}");
+  print("}");
 }
 
 
@@ -2984,9 +3176,9 @@ void
 WriteSdc::writeSetupHoldFlag(const MinMaxAll *min_max) const
 {
   if (min_max == MinMaxAll::min())
-    gzprintf(stream_,  " -hold");
+    print(" -hold");
   else if (min_max == MinMaxAll::max())
-    gzprintf(stream_,  " -setup");
+    print(" -setup");
 }
 
 static const char *
@@ -3000,7 +3192,7 @@ WriteSdc::writeCmdComment(SdcCmdComment *cmd) const
 {
   const char *comment = cmd->comment();
   if (comment) {
-    gzprintf(stream_,  " -comment {%s}", comment);
+    print(" -comment {%s}", comment);
   }
 }
 
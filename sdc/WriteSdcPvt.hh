@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <string>
+
 #include "Zlib.hh"
+#include "Vector.hh"
 #include "NetworkClass.hh"
 #include "GraphClass.hh"
 #include "Sdc.hh"
@@ -24,6 +27,10 @@
 namespace sta {
 
 class WriteSdcObject;
+class WriteSdc;
+
+typedef void (WriteSdc::*WriteSdcSection)() const;
+typedef Vector<WriteSdcSection> WriteSdcSectionSeq;
 
 class WriteSdc : public StaState
 {
@@ -36,6 +43,7 @@ public:
 	   bool no_timestamp,
 	   Sdc *sdc);
   virtual ~WriteSdc();
+  void setCollapseBuses(bool collapse_buses);
   void write(const char *filename,
              bool gzip);
 
@@ -43,7 +51,11 @@ public:
                 bool gzip);
   void closeFile();
   virtual void writeHeader() const;
-  void writeTiming() const;
+  void findSections(WriteSdcSectionSeq &sections) const;
+  void writeSectionsParallel(const WriteSdcSectionSeq &sections) const;
+  void print(const char *fmt,
+             ...) const __attribute__((format (printf, 2, 3)));
+  void writeTimingComment() const;
   void writeDisables() const;
   void writeDisabledCells() const;
   void writeDisabledPorts() const;
@@ -117,7 +129,7 @@ public:
 		      RiseFallBoth *to_rf,
 		      SetupHold *setup_hold,
 		      float margin) const;
-  void writeEnvironment() const;
+  void writeEnvironmentComment() const;
   void writeOperatingConditions() const;
   void writeWireload() const;
   virtual void writeNetLoads() const;
@@ -146,7 +158,7 @@ public:
   void writeNetResistance(Net *net,
 			  const MinMaxAll *min_max,
 			  float res) const;
-  void writeDesignRules() const;
+  void writeDesignRulesComment() const;
   void writeMinPulseWidths() const;
   void writeMinPulseWidths(RiseFallValues *min_widths,
 			   WriteSdcObject &write_obj) const;
@@ -198,6 +210,13 @@ public:
   void writeGetPins(PinSet *pins,
 		    bool map_hpin_to_drvr) const;
   void writeGetPins1(PinSeq *pins) const;
+  void collapseBusPins(PinSeq &pins,
+		       PinSet &bus_pins) const;
+  void writeGetBusPins(const Pin *pin) const;
+  const Port *pinBusPort(const Pin *pin) const;
+  bool hasAllBusPins(const Instance *inst,
+		     const Port *bus_port,
+		     const PinSet &pins) const;
   void writeClockKey(const Clock *clk) const;
   float scaleTime(float time) const;
   float scaleCapacitance(float cap) const;
@@ -248,8 +267,6 @@ public:
   void writeVariables() const;
   void writeCmdComment(SdcCmdComment *cmd) const;
 
-  gzFile stream() const { return stream_; }
-
 protected:
   Instance *instance_;
   const char *creator_;
@@ -257,6 +274,7 @@ protected:
   bool native_;
   int digits_;
   bool no_timestamp_;
+  bool collapse_buses_;
   bool top_instance_;
   size_t instance_name_length_;
   Cell *cell_;
@@ -16,6 +16,9 @@
 
 #include "CheckMaxSkews.hh"
 
+#include <algorithm>
+
+#include "DispatchQueue.hh"
 #include "TimingRole.hh"
 #include "TimingArc.hh"
 #include "Liberty.hh"
@@ -36,6 +39,11 @@ public:
   virtual ~MaxSkewCheckVisitor() {}
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta) = 0;
+  // Visitor with empty results for a thread to visit checks.
+  virtual MaxSkewCheckVisitor *copy() = 0;
+  // Merge the results of a thread's visitor.
+  virtual void mergeCopy(MaxSkewCheckVisitor *visitor,
+			 const StaState *sta) = 0;
 };
 
 CheckMaxSkews::CheckMaxSkews(StaState *sta) :
@@ -57,17 +65,20 @@ CheckMaxSkews::clear()
 class MaxSkewChecksVisitor : public MaxSkewCheckVisitor
 {
 public:
-  explicit MaxSkewChecksVisitor(MaxSkewCheckSeq &checks);
+  MaxSkewChecksVisitor();
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta);
+  virtual MaxSkewCheckVisitor *copy();
+  virtual void mergeCopy(MaxSkewCheckVisitor *visitor,
+			 const StaState *sta);
+  MaxSkewCheckSeq &checks() { return checks_; }
 
 private:
-  MaxSkewCheckSeq &checks_;
+  MaxSkewCheckSeq checks_;
 };
 
-MaxSkewChecksVisitor::MaxSkewChecksVisitor(MaxSkewCheckSeq &checks) :
-  MaxSkewCheckVisitor(),
-  checks_(checks)
+MaxSkewChecksVisitor::MaxSkewChecksVisitor() :
+  MaxSkewCheckVisitor()
 {
 }
 
@@ -78,21 +89,40 @@ MaxSkewChecksVisitor::visit(MaxSkewCheck &check,
   checks_.push_back(new MaxSkewCheck(check));
 }
 
+MaxSkewCheckVisitor *
+MaxSkewChecksVisitor::copy()
+{
+  return new MaxSkewChecksVisitor();
+}
+
+void
+MaxSkewChecksVisitor::mergeCopy(MaxSkewCheckVisitor *visitor,
+				const StaState *)
+{
+  MaxSkewChecksVisitor *checks_visitor =
+    dynamic_cast<MaxSkewChecksVisitor*>(visitor);
+  for (MaxSkewCheck *check : checks_visitor->checks_)
+    checks_.push_back(check);
+  checks_visitor->checks_.clear();
+}
+
 class MaxSkewViolatorsVisititor : public MaxSkewCheckVisitor
 {
 public:
-  explicit MaxSkewViolatorsVisititor(MaxSkewCheckSeq &checks);
+  MaxSkewViolatorsVisititor();
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta);
+  virtual MaxSkewCheckVisitor *copy();
+  virtual void mergeCopy(MaxSkewCheckVisitor *visitor,
+			 const StaState *sta);
+  MaxSkewCheckSeq &checks() { return checks_; }
 
 private:
-  MaxSkewCheckSeq &checks_;
+  MaxSkewCheckSeq checks_;
 };
 
-MaxSkewViolatorsVisititor::
-MaxSkewViolatorsVisititor(MaxSkewCheckSeq &checks) :
-  MaxSkewCheckVisitor(),
-  checks_(checks)
+MaxSkewViolatorsVisititor::MaxSkewViolatorsVisititor() :
+  MaxSkewCheckVisitor()
 {
 }
 
@@ -104,12 +134,30 @@ MaxSkewViolatorsVisititor::visit(MaxSkewCheck &check,
     checks_.push_back(new MaxSkewCheck(check));
 }
 
+MaxSkewCheckVisitor *
+MaxSkewViolatorsVisititor::copy()
+{
+  return new MaxSkewViolatorsVisititor();
+}
+
+void
+MaxSkewViolatorsVisititor::mergeCopy(MaxSkewCheckVisitor *visitor,
+				     const StaState *)
+{
+  MaxSkewViolatorsVisititor *violators =
+    dynamic_cast<MaxSkewViolatorsVisititor*>(visitor);
+  for (MaxSkewCheck *check : violators->checks_)
+    checks_.push_back(check);
+  violators->checks_.clear();
+}
+
 MaxSkewCheckSeq &
 CheckMaxSkews::violations()
 {
   clear();
-  MaxSkewViolatorsVisititor visitor(checks_);
+  MaxSkewViolatorsVisititor visitor;
   visitMaxSkewChecks(&visitor);
+  checks_.swap(visitor.checks());
   sort(checks_, MaxSkewSlackLess(sta_));
   return checks_;
 }
@@ -120,6 +168,9 @@ public:
   MaxSkewSlackVisitor();
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta);
+  virtual MaxSkewCheckVisitor *copy();
+  virtual void mergeCopy(MaxSkewCheckVisitor *visitor,
+			 const StaState *sta);
   MaxSkewCheck *minSlackCheck();
 
 private:
@@ -144,6 +195,32 @@ MaxSkewSlackVisitor::visit(MaxSkewCheck &check,
   }
 }
 
+MaxSkewCheckVisitor *
+MaxSkewSlackVisitor::copy()
+{
+  return new MaxSkewSlackVisitor();
+}
+
+void
+MaxSkewSlackVisitor::mergeCopy(MaxSkewCheckVisitor *visitor,
+			       const StaState *sta)
+{
+  MaxSkewSlackVisitor *slack_visitor =
+    dynamic_cast<MaxSkewSlackVisitor*>(visitor);
+  MaxSkewCheck *check = slack_visitor->min_slack_check_;
+  if (check) {
+    MaxSkewSlackLess slack_less(sta);
+    if (min_slack_check_ == nullptr
+	|| slack_less(check, min_slack_check_)) {
+      delete min_slack_check_;
+      min_slack_check_ = check;
+    }
+    else
+      delete check;
+    slack_visitor->min_slack_check_ = nullptr;
+  }
+}
+
 MaxSkewCheck *
 MaxSkewSlackVisitor::minSlackCheck()
 {
@@ -162,14 +239,46 @@ CheckMaxSkews::minSlackCheck()
   return check;
 }
 
+// Vertices with skew checks are visited by the threads with a copy of
+// the visitor for each thread that is merged into visitor.
 void
 CheckMaxSkews::visitMaxSkewChecks(MaxSkewCheckVisitor *visitor)
 {
   Graph *graph = sta_->graph();
-  VertexIterator vertex_iter(graph);
-  while (vertex_iter.hasNext()) {
-    Vertex *vertex = vertex_iter.next();
-    visitMaxSkewChecks(vertex, visitor);
+  size_t thread_count = sta_->threadCount();
+  if (thread_count == 1) {
+    VertexIterator vertex_iter(graph);
+    while (vertex_iter.hasNext()) {
+      Vertex *vertex = vertex_iter.next();
+      visitMaxSkewChecks(vertex, visitor);
+    }
+  }
+  else {
+    VertexSeq skew_vertices;
+    VertexIterator vertex_iter(graph);
+    while (vertex_iter.hasNext()) {
+      Vertex *vertex = vertex_iter.next();
+      if (vertex->hasChecks())
+	skew_vertices.push_back(vertex);
+    }
+    Vector<MaxSkewCheckVisitor*> visitors(thread_count);
+    for (size_t i = 0; i < thread_count; i++)
+      visitors[i] = visitor->copy();
+    DispatchQueue *dispatch_queue = sta_->dispatchQueue();
+    size_t vertex_count = skew_vertices.size();
+    size_t chunk_size = (vertex_count + thread_count - 1) / thread_count;
+    for (size_t begin = 0; begin < vertex_count; begin += chunk_size) {
+      size_t end = std::min(begin + chunk_size, vertex_count);
+      dispatch_queue->dispatch([=, &skew_vertices, &visitors] (int i) {
+	for (size_t k = begin; k < end; k++)
+	  visitMaxSkewChecks(skew_vertices[k], visitors[i]);
+      });
+    }
+    dispatch_queue->finishTasks();
+    for (MaxSkewCheckVisitor *thread_visitor : visitors) {
+      visitor->mergeCopy(thread_visitor, sta_);
+      delete thread_visitor;
+    }
   }
 }
 
@@ -269,10 +378,15 @@ MaxSkewSlackLess::operator()(const MaxSkewCheck *check1,
 {
   Slack slack1 = check1->slack(sta_);
   Slack slack2 = check2->slack(sta_);
+  const Pin *clk_pin1 = check1->clkPin(sta_);
+  const Pin *clk_pin2 = check2->clkPin(sta_);
   return delayLess(slack1, slack2, sta_)
     || (delayEqual(slack1, slack2)
-	// Break ties based on constrained pin names.
-	&& sta_->network()->pinLess(check1->clkPin(sta_),check2->clkPin(sta_)));
+	// Break ties based on constrained and reference pin names.
+	&& (sta_->network()->pinLess(clk_pin1, clk_pin2)
+	    || (clk_pin1 == clk_pin2
+		&& sta_->network()->pinLess(check1->refPin(sta_),
+					    check2->refPin(sta_)))));
 }
 
 } // namespace
@@ -16,6 +16,9 @@
 
 #include "CheckMinPeriods.hh"
 
+#include <algorithm>
+
+#include "DispatchQueue.hh"
 #include "Liberty.hh"
 #include "Network.hh"
 #include "Sdc.hh"
@@ -35,6 +38,11 @@ public:
   virtual ~MinPeriodCheckVisitor() {}
   virtual void visit(MinPeriodCheck &check,
 		     StaState *sta) = 0;
+  // Visitor with empty results for a thread to visit checks.
+  virtual MinPeriodCheckVisitor *copy() = 0;
+  // Merge the results of a thread's visitor.
+  virtual void mergeCopy(MinPeriodCheckVisitor *visitor,
+			 StaState *sta) = 0;
 };
 
 CheckMinPeriods::CheckMinPeriods(StaState *sta) :
@@ -56,16 +64,19 @@ CheckMinPeriods::clear()
 class MinPeriodViolatorsVisitor : public MinPeriodCheckVisitor
 {
 public:
-  MinPeriodViolatorsVisitor(MinPeriodCheckSeq &checks);
+  MinPeriodViolatorsVisitor();
   virtual void visit(MinPeriodCheck &check,
 		     StaState *sta);
+  virtual MinPeriodCheckVisitor *copy();
+  virtual void mergeCopy(MinPeriodCheckVisitor *visitor,
+			 StaState *sta);
+  MinPeriodCheckSeq &checks() { return checks_; }
 
 private:
-  MinPeriodCheckSeq &checks_;
+  MinPeriodCheckSeq checks_;
 };
 
-MinPeriodViolatorsVisitor::MinPeriodViolatorsVisitor(MinPeriodCheckSeq &checks):
-  checks_(checks)
+MinPeriodViolatorsVisitor::MinPeriodViolatorsVisitor()
 {
 }
 
@@ -77,25 +88,75 @@ MinPeriodViolatorsVisitor::visit(MinPeriodCheck &check,
     checks_.push_back(check.copy());
 }
 
+MinPeriodCheckVisitor *
+MinPeriodViolatorsVisitor::copy()
+{
+  return new MinPeriodViolatorsVisitor();
+}
+
+void
+MinPeriodViolatorsVisitor::mergeCopy(MinPeriodCheckVisitor *visitor,
+				     StaState *)
+{
+  MinPeriodViolatorsVisitor *violators =
+    dynamic_cast<MinPeriodViolatorsVisitor*>(visitor);
+  for (MinPeriodCheck *check : violators->checks_)
+    checks_.push_back(check);
+  violators->checks_.clear();
+}
+
 MinPeriodCheckSeq &
 CheckMinPeriods::violations()
 {
   clear();
-  MinPeriodViolatorsVisitor visitor(checks_);
+  MinPeriodViolatorsVisitor visitor;
   visitMinPeriodChecks(&visitor);
+  checks_.swap(visitor.checks());
   sort(checks_, MinPeriodSlackLess(sta_));
   return checks_;
 }
 
+// Clock end vertices are visited by the threads with a copy of the
+// visitor for each thread that is merged into visitor.
 void
 CheckMinPeriods::visitMinPeriodChecks(MinPeriodCheckVisitor *visitor)
 {
   Graph *graph = sta_->graph();
-  VertexIterator vertex_iter(graph);
-  while (vertex_iter.hasNext()) {
-    Vertex *vertex = vertex_iter.next();
-    if (isClkEnd(vertex, graph))
-      visitMinPeriodChecks(vertex, visitor);
+  size_t thread_count = sta_->threadCount();
+  if (thread_count == 1) {
+    VertexIterator vertex_iter(graph);
+    while (vertex_iter.hasNext()) {
+      Vertex *vertex = vertex_iter.next();
+      if (isClkEnd(vertex, graph))
+	visitMinPeriodChecks(vertex, visitor);
+    }
+  }
+  else {
+    VertexSeq clk_ends;
+    VertexIterator vertex_iter(graph);
+    while (vertex_iter.hasNext()) {
+      Vertex *vertex = vertex_iter.next();
+      if (isClkEnd(vertex, graph))
+	clk_ends.push_back(vertex);
+    }
+    Vector<MinPeriodCheckVisitor*> visitors(thread_count);
+    for (size_t i = 0; i < thread_count; i++)
+      visitors[i] = visitor->copy();
+    DispatchQueue *dispatch_queue = sta_->dispatchQueue();
+    size_t vertex_count = clk_ends.size();
+    size_t chunk_size = (vertex_count + thread_count - 1) / thread_count;
+    for (size_t begin = 0; begin < vertex_count; begin += chunk_size) {
+      size_t end = std::min(begin + chunk_size, vertex_count);
+      dispatch_queue->dispatch([=, &clk_ends, &visitors] (int i) {
+	for (size_t k = begin; k < end; k++)
+	  visitMinPeriodChecks(clk_ends[k], visitors[i]);
+      });
+    }
+    dispatch_queue->finishTasks();
+    for (MinPeriodCheckVisitor *thread_visitor : visitors) {
+      visitor->mergeCopy(thread_visitor, sta_);
+      delete thread_visitor;
+    }
   }
 }
 
@@ -129,6 +190,9 @@ public:
   MinPeriodSlackVisitor();
   virtual void visit(MinPeriodCheck &check,
 		     StaState *sta);
+  virtual MinPeriodCheckVisitor *copy();
+  virtual void mergeCopy(MinPeriodCheckVisitor *visitor,
+			 StaState *sta);
   MinPeriodCheck *minSlackCheck();
 
 private:
@@ -153,6 +217,32 @@ MinPeriodSlackVisitor::visit(MinPeriodCheck &check,
   }
 }
 
+MinPeriodCheckVisitor *
+MinPeriodSlackVisitor::copy()
+{
+  return new MinPeriodSlackVisitor();
+}
+
+void
+MinPeriodSlackVisitor::mergeCopy(MinPeriodCheckVisitor *visitor,
+				 StaState *sta)
+{
+  MinPeriodSlackVisitor *slack_visitor =
+    dynamic_cast<MinPeriodSlackVisitor*>(visitor);
+  MinPeriodCheck *check = slack_visitor->min_slack_check_;
+  if (check) {
+    MinPeriodSlackLess slack_less(sta);
+    if (min_slack_check_ == nullptr
+	|| slack_less(check, min_slack_check_)) {
+      delete min_slack_check_;
+      min_slack_check_ = check;
+    }
+    else
+      delete check;
+    slack_visitor->min_slack_check_ = nullptr;
+  }
+}
+
 MinPeriodCheck *
 MinPeriodSlackVisitor::minSlackCheck()
 {
@@ -16,6 +16,9 @@
 
 #include "CheckMinPulseWidths.hh"
 
+#include <algorithm>
+
+#include "DispatchQueue.hh"
 #include "Debug.hh"
 #include "TimingRole.hh"
 #include "Liberty.hh"
@@ -53,6 +56,11 @@ public:
   virtual ~MinPulseWidthCheckVisitor() {}
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta) = 0;
+  // Visitor with empty results for a thread to visit checks.
+  virtual MinPulseWidthCheckVisitor *copy() = 0;
+  // Merge the results of a thread's visitor.
+  virtual void mergeCopy(MinPulseWidthCheckVisitor *visitor,
+			 const StaState *sta) = 0;
 };
 
 CheckMinPulseWidths::CheckMinPulseWidths(StaState *sta) :
@@ -76,21 +84,22 @@ CheckMinPulseWidths::clear()
 class MinPulseWidthChecksVisitor : public MinPulseWidthCheckVisitor
 {
 public:
-  explicit MinPulseWidthChecksVisitor(const Corner *corner,
-				      MinPulseWidthCheckSeq &checks);
+  explicit MinPulseWidthChecksVisitor(const Corner *corner);
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta);
+  virtual MinPulseWidthCheckVisitor *copy();
+  virtual void mergeCopy(MinPulseWidthCheckVisitor *visitor,
+			 const StaState *sta);
+  MinPulseWidthCheckSeq &checks() { return checks_; }
 
 private:
   const Corner *corner_;
-  MinPulseWidthCheckSeq &checks_;
+  MinPulseWidthCheckSeq checks_;
 };
 
 MinPulseWidthChecksVisitor::
-MinPulseWidthChecksVisitor(const Corner *corner,
-			   MinPulseWidthCheckSeq &checks) :
-  corner_(corner),
-  checks_(checks)
+MinPulseWidthChecksVisitor(const Corner *corner) :
+  corner_(corner)
 {
 }
 
@@ -105,12 +114,30 @@ MinPulseWidthChecksVisitor::visit(MinPulseWidthCheck &check,
   }
 }
 
+MinPulseWidthCheckVisitor *
+MinPulseWidthChecksVisitor::copy()
+{
+  return new MinPulseWidthChecksVisitor(corner_);
+}
+
+void
+MinPulseWidthChecksVisitor::mergeCopy(MinPulseWidthCheckVisitor *visitor,
+				      const StaState *)
+{
+  MinPulseWidthChecksVisitor *checks_visitor =
+    dynamic_cast<MinPulseWidthChecksVisitor*>(visitor);
+  for (MinPulseWidthCheck *check : checks_visitor->checks_)
+    checks_.push_back(check);
+  checks_visitor->checks_.clear();
+}
+
 MinPulseWidthCheckSeq &
 CheckMinPulseWidths::check(const Corner *corner)
 {
   clear();
-  MinPulseWidthChecksVisitor visitor(corner, checks_);
+  MinPulseWidthChecksVisitor visitor(corner);
   visitMinPulseWidthChecks(&visitor);
+  checks_.swap(visitor.checks());
   sort(checks_, MinPulseWidthSlackLess(sta_));
   return checks_;
 }
@@ -121,13 +148,14 @@ CheckMinPulseWidths::check(PinSeq *pins,
 {
   clear();
   Graph *graph = sta_->graph();
-  MinPulseWidthChecksVisitor visitor(corner, checks_);
+  MinPulseWidthChecksVisitor visitor(corner);
   PinSeq::Iterator pin_iter(pins);
   while (pin_iter.hasNext()) {
     Pin *pin = pin_iter.next();
     Vertex *vertex = graph->pinLoadVertex(pin);
     visitMinPulseWidthChecks(vertex, &visitor);
   }
+  checks_.swap(visitor.checks());
   sort(checks_, MinPulseWidthSlackLess(sta_));
   return checks_;
 }
@@ -137,21 +165,22 @@ CheckMinPulseWidths::check(PinSeq *pins,
 class MinPulseWidthViolatorsVisitor : public MinPulseWidthCheckVisitor
 {
 public:
-  explicit MinPulseWidthViolatorsVisitor(const Corner *corner,
-					 MinPulseWidthCheckSeq &checks);
+  explicit MinPulseWidthViolatorsVisitor(const Corner *corner);
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta);
+  virtual MinPulseWidthCheckVisitor *copy();
+  virtual void mergeCopy(MinPulseWidthCheckVisitor *visitor,
+			 const StaState *sta);
+  MinPulseWidthCheckSeq &checks() { return checks_; }
 
 private:
   const Corner *corner_;
-  MinPulseWidthCheckSeq &checks_;
+  MinPulseWidthCheckSeq checks_;
 };
 
 MinPulseWidthViolatorsVisitor::
-MinPulseWidthViolatorsVisitor(const Corner *corner,
-			      MinPulseWidthCheckSeq &checks) :
-  corner_(corner),
-  checks_(checks)
+MinPulseWidthViolatorsVisitor(const Corner *corner) :
+  corner_(corner)
 {
 }
 
@@ -167,12 +196,30 @@ MinPulseWidthViolatorsVisitor::visit(MinPulseWidthCheck &check,
   }
 }
 
+MinPulseWidthCheckVisitor *
+MinPulseWidthViolatorsVisitor::copy()
+{
+  return new MinPulseWidthViolatorsVisitor(corner_);
+}
+
+void
+MinPulseWidthViolatorsVisitor::mergeCopy(MinPulseWidthCheckVisitor *visitor,
+					 const StaState *)
+{
+  MinPulseWidthViolatorsVisitor *violators =
+    dynamic_cast<MinPulseWidthViolatorsVisitor*>(visitor);
+  for (MinPulseWidthCheck *check : violators->checks_)
+    checks_.push_back(check);
+  violators->checks_.clear();
+}
+
 MinPulseWidthCheckSeq &
 CheckMinPulseWidths::violations(const Corner *corner)
 {
   clear();
-  MinPulseWidthViolatorsVisitor visitor(corner, checks_);
+  MinPulseWidthViolatorsVisitor visitor(corner);
   visitMinPulseWidthChecks(&visitor);
+  checks_.swap(visitor.checks());
   sort(checks_, MinPulseWidthSlackLess(sta_));
   return checks_;
 }
@@ -185,6 +232,9 @@ public:
   MinPulseWidthSlackVisitor(const Corner *corner);
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta);
+  virtual MinPulseWidthCheckVisitor *copy();
+  virtual void mergeCopy(MinPulseWidthCheckVisitor *visitor,
+			 const StaState *sta);
   MinPulseWidthCheck *minSlackCheck();
 
 private:
@@ -214,6 +264,32 @@ MinPulseWidthSlackVisitor::visit(MinPulseWidthCheck &check,
   }
 }
 
+MinPulseWidthCheckVisitor *
+MinPulseWidthSlackVisitor::copy()
+{
+  return new MinPulseWidthSlackVisitor(corner_);
+}
+
+void
+MinPulseWidthSlackVisitor::mergeCopy(MinPulseWidthCheckVisitor *visitor,
+				     const StaState *sta)
+{
+  MinPulseWidthSlackVisitor *slack_visitor =
+    dynamic_cast<MinPulseWidthSlackVisitor*>(visitor);
+  MinPulseWidthCheck *check = slack_visitor->min_slack_check_;
+  if (check) {
+    MinPulseWidthSlackLess slack_less(sta);
+    if (min_slack_check_ == nullptr
+	|| slack_less(check, min_slack_check_)) {
+      delete min_slack_check_;
+      min_slack_check_ = check;
+    }
+    else
+      delete check;
+    slack_visitor->min_slack_check_ = nullptr;
+  }
+}
+
 MinPulseWidthCheck *
 MinPulseWidthSlackVisitor::minSlackCheck()
 {
@@ -232,6 +308,8 @@ CheckMinPulseWidths::minSlackCheck(const Corner *corner)
   return check;
 }
 
+// Clock end vertices are visited by the threads with a copy of the
+// visitor for each thread that is merged into visitor.
 void
 CheckMinPulseWidths::
 visitMinPulseWidthChecks(MinPulseWidthCheckVisitor *visitor)
@@ -239,12 +317,44 @@ visitMinPulseWidthChecks(MinPulseWidthCheckVisitor *visitor)
   Graph *graph = sta_->graph();
   Debug *debug = sta_->debug();
   Network *sdc_network = sta_->network();
-  VertexIterator vertex_iter(graph);
-  while (vertex_iter.hasNext()) {
-    Vertex *vertex = vertex_iter.next();
-    if (isClkEnd(vertex, graph)) {
-      debugPrint(debug, "mpw", 1, "check mpw %s", vertex->name(sdc_network));
-      visitMinPulseWidthChecks(vertex, visitor);
+  size_t thread_count = sta_->threadCount();
+  if (thread_count == 1) {
+    VertexIterator vertex_iter(graph);
+    while (vertex_iter.hasNext()) {
+      Vertex *vertex = vertex_iter.next();
+      if (isClkEnd(vertex, graph)) {
+	debugPrint(debug, "mpw", 1, "check mpw %s", vertex->name(sdc_network));
+	visitMinPulseWidthChecks(vertex, visitor);
+      }
+    }
+  }
+  else {
+    VertexSeq clk_ends;
+    VertexIterator vertex_iter(graph);
+    while (vertex_iter.hasNext()) {
+      Vertex *vertex = vertex_iter.next();
+      if (isClkEnd(vertex, graph)) {
+	debugPrint(debug, "mpw", 1, "check mpw %s", vertex->name(sdc_network));
+	clk_ends.push_back(vertex);
+      }
+    }
+    Vector<MinPulseWidthCheckVisitor*> visitors(thread_count);
+    for (size_t i = 0; i < thread_count; i++)
+      visitors[i] = visitor->copy();
+    DispatchQueue *dispatch_queue = sta_->dispatchQueue();
+    size_t vertex_count = clk_ends.size();
+    size_t chunk_size = (vertex_count + thread_count - 1) / thread_count;
+    for (size_t begin = 0; begin < vertex_count; begin += chunk_size) {
+      size_t end = std::min(begin + chunk_size, vertex_count);
+      dispatch_queue->dispatch([=, &clk_ends, &visitors] (int i) {
+	for (size_t k = begin; k < end; k++)
+	  visitMinPulseWidthChecks(clk_ends[k], visitors[i]);
+      });
+    }
+    dispatch_queue->finishTasks();
+    for (MinPulseWidthCheckVisitor *thread_visitor : visitors) {
+      visitor->mergeCopy(thread_visitor, sta_);
+      delete thread_visitor;
     }
   }
 }
@@ -19,10 +19,10 @@
 #include "Debug.hh"
 #include "Network.hh"
 #include "Graph.hh"
-#include "Bfs.hh"
 #include "Sdc.hh"
 #include "SearchPred.hh"
 #include "Search.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -43,9 +43,10 @@ void
 ClkNetwork::clear()
 {
   clk_pins_valid_ = false;
-  pin_clks_map_.clear();
+  clk_sets_.clear();
+  pin_clk_sets_.clear();
+  pin_ideal_clk_sets_.clear();
   clk_pins_map_.clear();
-  pin_ideal_clks_map_.clear();
 }
 
 void
@@ -95,56 +96,159 @@ ClkSearchPred::searchTo(const Vertex *to)
   return !sdc->isLeafPinClock(to->pin());
 }
 
+// The clock networks of the clocks are found in parallel.
+// Pins are then assigned clock sets in clock order.
 void
 ClkNetwork::findClkPins()
 {
   debugPrint(debug_, "clk_network", 1, "find clk network");
   clear();
-  findClkPins(false, pin_clks_map_);
-  findClkPins(true, pin_ideal_clks_map_);
+  ClockSeq clks;
+  for (Clock *clk : sdc_->clks())
+    clks.push_back(clk);
+  size_t clk_count = clks.size();
+  Vector<VertexSeq> clk_vertices(clk_count);
+  Vector<VertexSeq> ideal_clk_vertices(clk_count);
+  std::vector<VertexVisited> visited(thread_count_);
+  if (thread_count_ == 1) {
+    for (size_t i = 0; i < clk_count; i++) {
+      Clock *clk = clks[i];
+      findClkVertices(clk, false, visited[0], clk_vertices[i]);
+      if (!clk->isPropagated())
+	findClkVertices(clk, true, visited[0], ideal_clk_vertices[i]);
+    }
+  }
+  else {
+    for (size_t i = 0; i < clk_count; i++) {
+      dispatch_queue_->dispatch([this, i, &clks, &visited, &clk_vertices,
+				 &ideal_clk_vertices](int thread_index) {
+	Clock *clk = clks[i];
+	VertexVisited &thread_visited = visited[thread_index];
+	findClkVertices(clk, false, thread_visited, clk_vertices[i]);
+	if (!clk->isPropagated())
+	  findClkVertices(clk, true, thread_visited, ideal_clk_vertices[i]);
+      });
+    }
+    dispatch_queue_->finishTasks();
+  }
+
+  clk_sets_.push_back(ClockSet());
+  ClkSetExtendMap extend_map;
+  recordClkPins(clks, clk_vertices, extend_map, pin_clk_sets_);
+  recordClkPins(clks, ideal_clk_vertices, extend_map, pin_ideal_clk_sets_);
+  for (size_t i = 0; i < clk_count; i++) {
+    PinSet &clk_pins = clk_pins_map_[clks[i]];
+    for (Vertex *vertex : clk_vertices[i])
+      clk_pins.insert(vertex->pin());
+  }
   clk_pins_valid_ = true;
 }
 
+// Search forward from the clock source pins without a BfsFwdIterator
+// because the vertex bfs flags are shared by the clock searches.
 void
-ClkNetwork::findClkPins(bool ideal_only,
-			PinClksMap &pin_clks_map)
+ClkNetwork::findClkVertices(Clock *clk,
+			    bool ideal_only,
+			    VertexVisited &visited,
+			    // Return value.
+			    VertexSeq &clk_vertices)
 {
   ClkSearchPred srch_pred(this);
-  BfsFwdIterator bfs(BfsIndex::other, &srch_pred, this);
-  for (Clock *clk : sdc_->clks()) {
+  VertexSeq queue;
+  for (Pin *pin : clk->leafPins()) {
     if (!ideal_only
-	|| !clk->isPropagated()) {
-      PinSet &clk_pins = clk_pins_map_[clk];
-      for (Pin *pin : clk->leafPins()) {
-	if (!ideal_only
-	    || !sdc_->isPropagatedClock(pin)) {
-	  Vertex *vertex, *bidirect_drvr_vertex;
-	  graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
-	  bfs.enqueue(vertex);
-	  if (bidirect_drvr_vertex)
-	    bfs.enqueue(bidirect_drvr_vertex);
+	|| !sdc_->isPropagatedClock(pin)) {
+      Vertex *vertex, *bidirect_drvr_vertex;
+      graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
+      queue.push_back(vertex);
+      if (bidirect_drvr_vertex)
+	queue.push_back(bidirect_drvr_vertex);
+    }
+  }
+  VertexSeq visited_vertices;
+  while (!queue.empty()) {
+    Vertex *vertex = queue.back();
+    queue.pop_back();
+    VertexId vertex_id = graph_->id(vertex);
+    if (vertex_id >= visited.size())
+      visited.resize(vertex_id + 1, false);
+    if (!visited[vertex_id]) {
+      visited[vertex_id] = true;
+      visited_vertices.push_back(vertex);
+      Pin *pin = vertex->pin();
+      if (!ideal_only
+	  || !sdc_->isPropagatedClock(pin)) {
+	clk_vertices.push_back(vertex);
+	if (srch_pred.searchFrom(vertex)) {
+	  VertexOutEdgeIterator edge_iter(vertex, graph_);
+	  while (edge_iter.hasNext()) {
+	    Edge *edge = edge_iter.next();
+	    Vertex *to_vertex = edge->to(graph_);
+	    if (srch_pred.searchThru(edge)
+		&& srch_pred.searchTo(to_vertex))
+	      queue.push_back(to_vertex);
+	  }
 	}
       }
-      while (bfs.hasNext()) {
-	Vertex *vertex = bfs.next();
-	Pin *pin = vertex->pin();
-	if (!ideal_only
-	    || !sdc_->isPropagatedClock(pin)) {
-	  clk_pins.insert(pin);
-	  ClockSet &pin_clks = pin_clks_map[pin];
-	  pin_clks.insert(clk);
-	  bfs.enqueueAdjacentVertices(vertex);
+    }
+  }
+  // Reset the visited flags for the next clock searched by this thread.
+  for (Vertex *vertex : visited_vertices)
+    visited[graph_->id(vertex)] = false;
+}
+
+void
+ClkNetwork::recordClkPins(ClockSeq &clks,
+			  Vector<VertexSeq> &clk_vertices,
+			  ClkSetExtendMap &extend_map,
+			  ClkSetIds &pin_clk_sets)
+{
+  for (size_t i = 0; i < clks.size(); i++) {
+    Clock *clk = clks[i];
+    for (Vertex *vertex : clk_vertices[i]) {
+      // Bidirect driver vertices are recorded under the pin's vertex.
+      VertexId pin_vertex_id = network_->vertexId(vertex->pin());
+      if (pin_vertex_id >= pin_clk_sets.size())
+	pin_clk_sets.resize(pin_vertex_id + 1, 0);
+      int clk_set_id = pin_clk_sets[pin_vertex_id];
+      if (!clk_sets_[clk_set_id].hasKey(clk)) {
+	// Clocks are added to sets in clock order so a set with the
+	// same clocks is always found by the same extension.
+	std::pair<int, int> key(clk_set_id, clk->index());
+	auto extend_itr = extend_map.find(key);
+	int ext_set_id;
+	if (extend_itr == extend_map.end()) {
+	  ext_set_id = clk_sets_.size();
+	  ClockSet ext_set(clk_sets_[clk_set_id]);
+	  ext_set.insert(clk);
+	  clk_sets_.push_back(ext_set);
+	  extend_map[key] = ext_set_id;
 	}
+	else
+	  ext_set_id = extend_itr->second;
+	pin_clk_sets[pin_vertex_id] = ext_set_id;
       }
     }
   }
 }
 
+int
+ClkNetwork::clkSetId(const Pin *pin,
+		     const ClkSetIds &pin_clk_sets) const
+{
+  VertexId vertex_id = network_->vertexId(pin);
+  if (vertex_id != object_id_null
+      && vertex_id < pin_clk_sets.size())
+    return pin_clk_sets[vertex_id];
+  else
+    return 0;
+}
+
 bool
 ClkNetwork::isClock(const Pin *pin) const
 {
   return network_->isRegClkPin(pin)
-    || pin_clks_map_.hasKey(pin);
+    || clkSetId(pin, pin_clk_sets_) != 0;
 }
 
 bool
@@ -166,21 +270,22 @@ ClkNetwork::isClock(const Net *net) const
 bool
 ClkNetwork::isIdealClock(const Pin *pin) const
 {
-  return pin_ideal_clks_map_.hasKey(pin);
+  return clkSetId(pin, pin_ideal_clk_sets_) != 0;
 }
 
 bool
 ClkNetwork::isPropagatedClock(const Pin *pin) const
 {
-  return pin_clks_map_.hasKey(pin)
-    && !pin_ideal_clks_map_.hasKey(pin);
+  return clkSetId(pin, pin_clk_sets_) != 0
+    && clkSetId(pin, pin_ideal_clk_sets_) == 0;
 }
 
 const ClockSet *
 ClkNetwork::clocks(const Pin *pin)
 {
-  if (pin_clks_map_.hasKey(pin))
-    return &pin_clks_map_[pin];
+  int clk_set_id = clkSetId(pin, pin_clk_sets_);
+  if (clk_set_id != 0)
+    return &clk_sets_[clk_set_id];
   else
     return nullptr;
 }
@@ -188,8 +293,9 @@ ClkNetwork::clocks(const Pin *pin)
 const ClockSet *
 ClkNetwork::idealClocks(const Pin *pin)
 {
-  if (pin_ideal_clks_map_.hasKey(pin))
-    return &pin_ideal_clks_map_[pin];
+  int clk_set_id = clkSetId(pin, pin_ideal_clk_sets_);
+  if (clk_set_id != 0)
+    return &clk_sets_[clk_set_id];
   else
     return nullptr;
 }
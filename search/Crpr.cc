@@ -20,8 +20,11 @@
 #include <stdio.h>
 
 #include "Debug.hh"
+#include "Stats.hh"
+#include "Hash.hh"
 #include "Vector.hh"
 #include "Network.hh"
+#include "PortDirection.hh"
 #include "Graph.hh"
 #include "Sdc.hh"
 #include "PathVertex.hh"
@@ -42,10 +45,18 @@ using std::min;
 using std::abs;
 
 CheckCrpr::CheckCrpr(StaState *sta) :
-  StaState(sta)
+  StaState(sta),
+  clk_tree_valid_(false),
+  clk_tree_indexed_(true)
 {
 }
 
+void
+CheckCrpr::clkPathsChanged()
+{
+  clk_tree_valid_ = false;
+}
+
 PathVertex *
 CheckCrpr::clkPathPrev(const PathVertex *path,
 		       PathVertex &tmp)
@@ -215,6 +226,120 @@ CheckCrpr::findCrpr(const PathVertex *src_clk_path,
 {
   crpr = 0.0;
   crpr_pin = nullptr;
+  PathVertex src_common_path, tgt_common_path;
+  findCommonPaths(src_clk_path, tgt_clk_path, same_pin,
+		  src_common_path, tgt_common_path);
+  if (!src_common_path.isNull()) {
+    debugPrint(debug_, "crpr", 2, "crpr pin %s",
+               network_->pathName(src_common_path.pin(this)));
+    crpr = findCrpr1(&src_common_path, &tgt_common_path);
+    crpr_pin = src_common_path.pin(this);
+  }
+}
+
+void
+CheckCrpr::findCommonPaths(const PathVertex *src_clk_path,
+			   const PathVertex *tgt_clk_path,
+			   bool same_pin,
+			   // Return values.
+			   PathVertex &src_common_path,
+			   PathVertex &tgt_common_path)
+{
+  PathVertexRep src_common, tgt_common;
+  if (src_clk_path->clkInfo(this)->clkSrc()
+      == tgt_clk_path->clkInfo(this)->clkSrc()
+      && findCommonPathsIndexed(src_clk_path, tgt_clk_path,
+				src_common, tgt_common)) {
+    src_common_path.init();
+    tgt_common_path.init();
+    if (!src_common.isNull()) {
+      PathVertex src_common1(src_common, this);
+      PathVertex tgt_common1(tgt_common, this);
+      if (src_common1.transition(this) == tgt_common1.transition(this)
+	  || same_pin) {
+	src_common_path = src_common1;
+	tgt_common_path = tgt_common1;
+      }
+    }
+  }
+  else
+    findCommonPaths1(src_clk_path, tgt_clk_path, same_pin,
+		     src_common_path, tgt_common_path);
+}
+
+// Find the deepest common vertex of the source and target clock paths
+// from the clock path tree index. Return false if either clock path
+// is not indexed.
+bool
+CheckCrpr::findCommonPathsIndexed(const PathVertex *src_clk_path,
+				  const PathVertex *tgt_clk_path,
+				  // Return values.
+				  PathVertexRep &src_common_path,
+				  PathVertexRep &tgt_common_path)
+{
+  if (!clk_tree_valid_)
+    return false;
+  PathVertexRep src_path(src_clk_path, this);
+  PathVertexRep tgt_path(tgt_clk_path, this);
+  const CrprClkNode *src_node = clkTreeNode(src_path);
+  const CrprClkNode *tgt_node = clkTreeNode(tgt_path);
+  if (src_node == nullptr || tgt_node == nullptr)
+    return false;
+  // Jump the deeper clock path up to the depth of the other one.
+  while (src_node->depth_ != tgt_node->depth_) {
+    bool src_deeper = src_node->depth_ > tgt_node->depth_;
+    PathVertexRep &path = src_deeper ? src_path : tgt_path;
+    const CrprClkNode *&node = src_deeper ? src_node : tgt_node;
+    int diff = abs(src_node->depth_ - tgt_node->depth_);
+    size_t k = 0;
+    while ((2 << k) <= diff)
+      k++;
+    path.init(node->ancestors_[k]);
+    node = clkTreeNode(path);
+  }
+  // Pins above an indexed clock path determine the rest of the path,
+  // so the paths share every vertex above the deepest common one.
+  if (src_path.vertexId() != tgt_path.vertexId()) {
+    for (int k = src_node->ancestors_.size() - 1; k >= 0; k--) {
+      if (static_cast<size_t>(k) < src_node->ancestors_.size()) {
+	const PathVertexRep &src_ancestor = src_node->ancestors_[k];
+	const PathVertexRep &tgt_ancestor = tgt_node->ancestors_[k];
+	if (src_ancestor.vertexId() != tgt_ancestor.vertexId()) {
+	  src_path.init(src_ancestor);
+	  tgt_path.init(tgt_ancestor);
+	  src_node = clkTreeNode(src_path);
+	  tgt_node = clkTreeNode(tgt_path);
+	}
+      }
+    }
+    if (src_node->ancestors_.empty()
+	|| src_node->ancestors_[0].vertexId()
+	!= tgt_node->ancestors_[0].vertexId()) {
+      // Different clock path tree roots.
+      src_path.init();
+      tgt_path.init();
+    }
+    else {
+      src_path.init(src_node->ancestors_[0]);
+      tgt_path.init(tgt_node->ancestors_[0]);
+    }
+  }
+  src_common_path.init(src_path);
+  tgt_common_path.init(tgt_path);
+  return true;
+}
+
+// Walk the source and target clock paths back to the first common pin.
+void
+CheckCrpr::findCommonPaths1(const PathVertex *src_clk_path,
+			    const PathVertex *tgt_clk_path,
+			    bool same_pin,
+			    // Return values.
+			    PathVertex &src_common_path,
+			    PathVertex &tgt_common_path)
+{
+  src_common_path.init();
+  tgt_common_path.init();
   const PathVertex *src_clk_path1 = src_clk_path;
   const PathVertex *tgt_clk_path1 = tgt_clk_path;
   PathVertexSeq src_gclk_paths, tgt_gclk_paths;
@@ -258,10 +383,8 @@ CheckCrpr::findCrpr(const PathVertex *src_clk_path,
   if (src_clk_path2 && tgt_clk_path2
       && (src_clk_path2->transition(this) == tgt_clk_path2->transition(this)
 	  || same_pin)) {
-    debugPrint(debug_, "crpr", 2, "crpr pin %s",
-               network_->pathName(src_clk_path2->pin(this)));
-    crpr = findCrpr1(src_clk_path2, tgt_clk_path2);
-    crpr_pin = src_clk_path2->pin(this);
+    src_common_path = *src_clk_path2;
+    tgt_common_path = *tgt_clk_path2;
   }
 }
 
@@ -390,6 +513,146 @@ CheckCrpr::outputDelayCrpr1(const Path *src_path,
   }
 }
 
+////////////////////////////////////////////////////////////////
+
+void
+CheckCrpr::setClkTreeIndexed(bool indexed)
+{
+  clk_tree_indexed_ = indexed;
+  clk_tree_.clear();
+  clk_tree_valid_ = false;
+}
+
+void
+CheckCrpr::ensureClkTree()
+{
+  if (clk_tree_indexed_
+      && !clk_tree_valid_
+      && sdc_->crprEnabled()) {
+    findClkTree();
+    clk_tree_valid_ = true;
+  }
+}
+
+void
+CheckCrpr::findClkTree()
+{
+  Stats stats(debug_, report_);
+  clk_tree_.clear();
+  VertexSeq clk_vertices;
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    if (graph_->prevPaths(vertex)
+	&& !network_->direction(vertex->pin())->isBidirect())
+      clk_vertices.push_back(vertex);
+  }
+  // Index previous clock paths first.
+  sort(clk_vertices, [] (const Vertex *vertex1,
+			 const Vertex *vertex2) {
+			  return vertex1->level() < vertex2->level();
+			});
+  for (Vertex *vertex : clk_vertices) {
+    TagGroup *tag_group = search_->tagGroup(vertex);
+    PathVertexRep *prev_paths = graph_->prevPaths(vertex);
+    if (tag_group) {
+      // Index the vertex clock paths only if they all have the same
+      // previous vertex.
+      VertexId prev_vertex_id = 0;
+      bool first = true;
+      bool same_prev = true;
+      ArrivalMap::Iterator arrival_iter(tag_group->arrivalMap());
+      while (arrival_iter.hasNext()) {
+	Tag *tag;
+	int arrival_index;
+	arrival_iter.next(tag, arrival_index);
+	if (tag->isClock() || tag->isGenClkSrcPath()) {
+	  VertexId vertex_id = prev_paths[arrival_index].vertexId();
+	  if (first) {
+	    prev_vertex_id = vertex_id;
+	    first = false;
+	  }
+	  else if (vertex_id != prev_vertex_id) {
+	    same_prev = false;
+	    break;
+	  }
+	}
+      }
+      if (same_prev) {
+	VertexId vertex_id = graph_->id(vertex);
+	ArrivalMap::Iterator arrival_iter(tag_group->arrivalMap());
+	while (arrival_iter.hasNext()) {
+	  Tag *tag;
+	  int arrival_index;
+	  arrival_iter.next(tag, arrival_index);
+	  if (tag->isClock() || tag->isGenClkSrcPath()) {
+	    PathVertexRep path(vertex_id, tag->index(), false);
+	    findClkTreeNode(path, prev_paths[arrival_index]);
+	  }
+	}
+      }
+    }
+  }
+  debugPrint(debug_, "crpr", 1, "clock tree index %zu paths",
+	     clk_tree_.size());
+  stats.report("Find crpr clk tree");
+}
+
+void
+CheckCrpr::findClkTreeNode(const PathVertexRep &path,
+			   const PathVertexRep &prev_path)
+{
+  CrprClkNode node;
+  if (prev_path.isNull())
+    node.depth_ = 0;
+  else {
+    const CrprClkNode *prev_node = clkTreeNode(prev_path);
+    if (prev_node == nullptr)
+      // The previous clock path is not indexed.
+      return;
+    node.depth_ = prev_node->depth_ + 1;
+    node.ancestors_.push_back(prev_path);
+    // The 2^k ancestor of the 2^k ancestor is the 2^(k+1) ancestor.
+    const CrprClkNode *ancestor = prev_node;
+    size_t k = 0;
+    while (k < ancestor->ancestors_.size()) {
+      const PathVertexRep &ancestor_path = ancestor->ancestors_[k];
+      node.ancestors_.push_back(ancestor_path);
+      ancestor = clkTreeNode(ancestor_path);
+      k++;
+    }
+  }
+  clk_tree_[path] = node;
+}
+
+const CrprClkNode *
+CheckCrpr::clkTreeNode(const PathVertexRep &path) const
+{
+  auto node_iter = clk_tree_.find(path);
+  if (node_iter == clk_tree_.end())
+    return nullptr;
+  else
+    return &node_iter->second;
+}
+
+size_t
+PathVertexRepHash::operator()(const PathVertexRep &path) const
+{
+  size_t hash = hash_init_value;
+  hashIncr(hash, path.vertexId());
+  hashIncr(hash, path.tagIndex());
+  return hash;
+}
+
+bool
+PathVertexRepEqual::operator()(const PathVertexRep &path1,
+			       const PathVertexRep &path2) const
+{
+  return PathVertexRep::equal(path1, path2);
+}
+
+////////////////////////////////////////////////////////////////
+
 bool
 CheckCrpr::crprPossible(Clock *clk1,
 			Clock *clk2)
@@ -16,14 +16,45 @@
 
 #pragma once
 
+#include <atomic>
+
+#include "UnorderedMap.hh"
+#include "Vector.hh"
 #include "SdcClass.hh"
 #include "StaState.hh"
 #include "SearchClass.hh"
+#include "PathVertexRep.hh"
 
 namespace sta {
 
 class CrprPaths;
 
+// Clock path in the clock path tree index.
+class CrprClkNode
+{
+public:
+  // Clock path edges from the clock path tree root.
+  int depth_;
+  // Ancestor clock paths 1, 2, 4... edges toward the root.
+  Vector<PathVertexRep> ancestors_;
+};
+
+class PathVertexRepHash
+{
+public:
+  size_t operator()(const PathVertexRep &path) const;
+};
+
+class PathVertexRepEqual
+{
+public:
+  bool operator()(const PathVertexRep &path1,
+		  const PathVertexRep &path2) const;
+};
+
+typedef UnorderedMap<PathVertexRep, CrprClkNode,
+		     PathVertexRepHash, PathVertexRepEqual> CrprClkTree;
+
 // Clock Reconvergence Pessimism Removal.
 class CheckCrpr : public StaState
 {
@@ -54,6 +85,16 @@ public:
   // For Search::reportArrivals.
   PathVertex clkPathPrev(Vertex *vertex,
 			 int arrival_index);
+  // Clock arrivals or previous paths changed so the clock path tree
+  // index is no longer valid.
+  void clkPathsChanged();
+  // Index the clock path trees after clock arrivals are found.
+  // The index is read-only during the search.
+  void ensureClkTree();
+  // Use the clock path tree index to find common clock paths
+  // (default true). Without it the clock paths are walked.
+  void setClkTreeIndexed(bool indexed);
+  size_t clkTreePathCount() const { return clk_tree_.size(); }
 
 private:
   PathVertex *clkPathPrev(const PathVertex *path,
@@ -87,9 +128,39 @@ private:
 		   const PathAnalysisPt *path_ap,
 		   // Return value.
 		   PathVertex &port_clk_path);
+  void findCommonPaths(const PathVertex *src_clk_path,
+		       const PathVertex *tgt_clk_path,
+		       bool same_pin,
+		       // Return values.
+		       PathVertex &src_common_path,
+		       PathVertex &tgt_common_path);
+  bool findCommonPathsIndexed(const PathVertex *src_clk_path,
+			      const PathVertex *tgt_clk_path,
+			      // Return values.
+			      PathVertexRep &src_common_path,
+			      PathVertexRep &tgt_common_path);
+  void findCommonPaths1(const PathVertex *src_clk_path,
+			const PathVertex *tgt_clk_path,
+			bool same_pin,
+			// Return values.
+			PathVertex &src_common_path,
+			PathVertex &tgt_common_path);
   Crpr findCrpr1(const PathVertex *src_clk_path,
 		 const PathVertex *tgt_clk_path);
   float crprArrivalDiff(const PathVertex *path);
+
+  void findClkTree();
+  void findClkTreeNode(const PathVertexRep &path,
+		       const PathVertexRep &prev_path);
+  const CrprClkNode *clkTreeNode(const PathVertexRep &path) const;
+
+  // Clock paths whose pins determine the clock path back to the root,
+  // so common clock pins can be found with ancestor jumps instead of
+  // walking the clock paths. Clock paths below a pin with clock paths
+  // from more than one previous vertex are not indexed.
+  CrprClkTree clk_tree_;
+  std::atomic<bool> clk_tree_valid_;
+  bool clk_tree_indexed_;
 };
 
 } // namespace
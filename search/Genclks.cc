@@ -34,6 +34,7 @@
 #include "Levelize.hh"
 #include "PathVertexRep.hh"
 #include "Search.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -212,11 +213,14 @@ Genclks::ensureInsertionDelays()
     // insertion delay, so sort the clocks by source pin level.
     sort(gclks, ClockPinMaxLevelLess(this));
 
-    ClockSeq::Iterator gclk_iter(gclks);
-    while (gclk_iter.hasNext()) {
-      Clock *gclk = gclk_iter.next();
+    Vector<VertexSet*> fanins;
+    findFanins(gclks, fanins);
+    // The source path searches share the graph arrivals so they are
+    // done in level order one clock at a time.
+    for (size_t i = 0; i < gclks.size(); i++) {
+      Clock *gclk = gclks[i];
       if (gclk->masterClk()) {
-	findInsertionDelays(gclk);
+	findInsertionDelays(gclk, fanins[i]);
 	if (gclk->pllOut())
 	  findPllDelays(gclk);
 	recordSrcPaths(gclk);
@@ -446,39 +450,91 @@ GenClkFaninSrchPred::searchTo(const Vertex *)
   return true;
 }
 
+// The fanin of each generated clock only depends on the graph,
+// so the fanins of all of the generated clocks are found in parallel.
+void
+Genclks::findFanins(ClockSeq &gclks,
+		    // Return value.
+		    Vector<VertexSet*> &fanins)
+{
+  fanins.resize(gclks.size(), nullptr);
+  for (size_t i = 0; i < gclks.size(); i++) {
+    if (gclks[i]->masterClk())
+      fanins[i] = new VertexSet(graph_);
+  }
+  if (thread_count_ == 1) {
+    for (size_t i = 0; i < gclks.size(); i++) {
+      if (fanins[i])
+	findFanin(gclks[i], fanins[i]);
+    }
+  }
+  else {
+    for (size_t i = 0; i < gclks.size(); i++) {
+      if (fanins[i])
+	dispatch_queue_->dispatch([this, &gclks, &fanins, i](int) {
+	  findFanin(gclks[i], fanins[i]);
+	});
+    }
+    dispatch_queue_->finishTasks();
+  }
+}
+
+// Search backward from generated clock source pin to a clock pin.
+// This does not use a BfsBkwdIterator because the vertex bfs flags
+// are shared by all of the fanin searches.
 void
 Genclks::findFanin(Clock *gclk,
 		   // Return value.
 		   VertexSet *fanins)
 {
-  // Search backward from generated clock source pin to a clock pin.
   GenClkFaninSrchPred srch_pred(gclk, this);
-  BfsBkwdIterator iter(BfsIndex::other, &srch_pred, this);
-  seedClkVertices(gclk, iter, fanins);
-  while (iter.hasNext()) {
-    Vertex *vertex = iter.next();
+  VertexSeq queue;
+  seedClkVertices(gclk, srch_pred, fanins, queue);
+  while (!queue.empty()) {
+    Vertex *vertex = queue.back();
+    queue.pop_back();
     if (!fanins->hasKey(vertex)) {
       fanins->insert(vertex);
       debugPrint(debug_, "genclk", 2, "gen clk %s fanin %s",
                  gclk->name(), vertex->name(sdc_network_));
-      iter.enqueueAdjacentVertices(vertex);
+      enqueueFaninVertices(vertex, srch_pred, fanins, queue);
     }
   }
 }
 
 void
 Genclks::seedClkVertices(Clock *clk,
-			 BfsBkwdIterator &iter,
-			 VertexSet *fanins)
+			 SearchPred &srch_pred,
+			 VertexSet *fanins,
+			 VertexSeq &queue)
 {
   for (Pin *pin : clk->leafPins()) {
     Vertex *vertex, *bidirect_drvr_vertex;
     graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
     fanins->insert(vertex);
-    iter.enqueueAdjacentVertices(vertex);
+    enqueueFaninVertices(vertex, srch_pred, fanins, queue);
     if (bidirect_drvr_vertex) {
       fanins->insert(bidirect_drvr_vertex);
-      iter.enqueueAdjacentVertices(bidirect_drvr_vertex);
+      enqueueFaninVertices(bidirect_drvr_vertex, srch_pred, fanins, queue);
+    }
+  }
+}
+
+void
+Genclks::enqueueFaninVertices(Vertex *vertex,
+			      SearchPred &srch_pred,
+			      VertexSet *fanins,
+			      VertexSeq &queue)
+{
+  if (srch_pred.searchTo(vertex)) {
+    VertexInEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      Vertex *from_vertex = edge->from(graph_);
+      if (!fanins->hasKey(from_vertex)
+	  && srch_pred.searchFrom(from_vertex)
+	  && srch_pred.searchThru(edge))
+	queue.push_back(from_vertex);
     }
   }
 }
@@ -561,11 +617,12 @@ GenClkInsertionSearchPred::isNonGeneratedClkPin(const Pin *pin) const
 ////////////////////////////////////////////////////////////////
 
 void
-Genclks::findInsertionDelays(Clock *gclk)
+Genclks::findInsertionDelays(Clock *gclk,
+			     VertexSet *fanins)
 {
   debugPrint(debug_, "genclk", 2, "find gen clk %s insertion",
              gclk->name());
-  GenclkInfo *genclk_info = makeGenclkInfo(gclk);
+  GenclkInfo *genclk_info = makeGenclkInfo(gclk, fanins);
   FilterPath *src_filter = genclk_info->srcFilter();
   GenClkInsertionSearchPred srch_pred(gclk, nullptr, genclk_info, this);
   BfsFwdIterator insert_iter(BfsIndex::other, &srch_pred, this);
@@ -579,12 +636,11 @@ Genclks::findInsertionDelays(Clock *gclk)
 }
 
 GenclkInfo *
-Genclks::makeGenclkInfo(Clock *gclk)
+Genclks::makeGenclkInfo(Clock *gclk,
+			VertexSet *fanins)
 {
   FilterPath *src_filter = makeSrcFilter(gclk);
   Level gclk_level = clkPinMaxLevel(gclk);
-  VertexSet *fanins = new VertexSet(graph_);
-  findFanin(gclk, fanins);
   GenclkInfo *genclk_info = new GenclkInfo(gclk, gclk_level, fanins,
 					    src_filter);
   genclk_info_map_.insert(gclk, genclk_info);
@@ -894,8 +950,7 @@ void
 Genclks::copyGenClkSrcPaths(Vertex *vertex,
 			    TagGroupBldr *tag_bldr)
 {
-  Arrival *arrivals = graph_->arrivals(vertex);
-  if (arrivals) {
+  if (vertex->hasArrivals()) {
     PathVertexRep *prev_paths = graph_->prevPaths(vertex);
     TagGroup *tag_group = search_->tagGroup(vertex);
     if (tag_group) {
@@ -905,7 +960,7 @@ Genclks::copyGenClkSrcPaths(Vertex *vertex,
         int arrival_index;
         arrival_iter.next(tag, arrival_index);
         if (tag->isGenClkSrcPath()) {
-          Arrival arrival = arrivals[arrival_index];
+          Arrival arrival = graph_->arrival(vertex, arrival_index);
           PathVertexRep *prev_path = prev_paths
             ? &prev_paths[arrival_index]
             : nullptr;
@@ -91,10 +91,16 @@ private:
   GenclkInfo *genclkInfo(const Clock *gclk) const;
   void clearSrcPaths();
   void recordSrcPaths(Clock *gclk);
-  void findInsertionDelays(Clock *gclk);
+  void findInsertionDelays(Clock *gclk,
+			   VertexSet *fanins);
   void seedClkVertices(Clock *clk,
-		       BfsBkwdIterator &iter,
-		       VertexSet *fanins);
+		       SearchPred &srch_pred,
+		       VertexSet *fanins,
+		       VertexSeq &queue);
+  void enqueueFaninVertices(Vertex *vertex,
+			    SearchPred &srch_pred,
+			    VertexSet *fanins,
+			    VertexSeq &queue);
   int srcPathIndex(const RiseFall *clk_rf,
 		   const PathAnalysisPt *path_ap) const;
   bool matchesSrcFilter(Path *path,
@@ -125,8 +131,12 @@ private:
   void seedSrcPins(Clock *clk,
 		   BfsBkwdIterator &iter);
   void findInsertionDelay(Clock *gclk);
-  GenclkInfo *makeGenclkInfo(Clock *gclk);
+  GenclkInfo *makeGenclkInfo(Clock *gclk,
+			     VertexSet *fanins);
   FilterPath *srcFilter(Clock *gclk);
+  void findFanins(ClockSeq &gclks,
+		  // Return value.
+		  Vector<VertexSet*> &fanins);
   void findFanin(Clock *gclk,
 		 // Return value.
 		 VertexSet *fanins);
@@ -16,7 +16,10 @@
 
 #include "PathEnum.hh"
 
+#include <algorithm>
+
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Error.hh"
 #include "Fuzzy.hh"
 #include "TimingRole.hh"
@@ -109,7 +112,10 @@ PathEnum::PathEnum(int group_count,
   div_queue_(DiversionGreater(sta)),
   div_count_(0),
   inserts_pruned_(false),
-  next_(nullptr)
+  next_(nullptr),
+  threshold_(0.0),
+  have_threshold_(false),
+  endpoint_end_index_(0)
 {
 }
 
@@ -137,18 +143,28 @@ PathEnum::~PathEnum()
   }
   // PathEnd on deck may not have been consumed.
   delete next_;
+  for (size_t i = endpoint_end_index_; i < endpoint_ends_.size(); i++)
+    delete endpoint_ends_[i];
 }
 
 bool
 PathEnum::hasNext()
 {
-  if (unique_pins_
-      && !inserts_pruned_) {
-    pruneDiversionQueue();
+  if (!inserts_pruned_) {
+    if (unique_pins_)
+      pruneDiversionQueue();
     inserts_pruned_ = true;
+    // With unique pins, pruneDiversionQueue keeps one diversion per
+    // endpoint when the shared queue fills, so the paths found for an
+    // endpoint depend on the other endpoints unless only one path per
+    // endpoint is reported.
+    if (thread_count_ > 1
+	&& (!unique_pins_ || endpoint_count_ == 1))
+      enumEndpoints();
   }
   if (next_ == nullptr
-      && !div_queue_.empty())
+      && (!div_queue_.empty()
+	  || endpoint_end_index_ < endpoint_ends_.size()))
     findNext();
   return next_ != nullptr;
 }
@@ -165,6 +181,10 @@ void
 PathEnum::findNext()
 {
   next_ = nullptr;
+  if (endpoint_end_index_ < endpoint_ends_.size()) {
+    next_ = endpoint_ends_[endpoint_end_index_++];
+    return;
+  }
   // Pop the next slowest path off the queue.
   while (!div_queue_.empty()) {
     Diversion *div = div_queue_.top();
@@ -199,6 +219,135 @@ PathEnum::findNext()
   }
 }
 
+// Paths for different endpoints do not share diversions, so each
+// endpoint is enumerated by a separate PathEnum and the results merged.
+void
+PathEnum::enumEndpoints()
+{
+  DiversionSeq divs;
+  while (!div_queue_.empty()) {
+    divs.push_back(div_queue_.top());
+    div_queue_.pop();
+  }
+  setThreshold(divs);
+
+  // Group the inserted path ends by endpoint.
+  Vector<DiversionSeq> endpoint_divs;
+  Map<Vertex*, size_t> endpoint_indices;
+  for (Diversion *div : divs) {
+    Vertex *vertex = div->pathEnd()->vertex(this);
+    size_t index;
+    bool exists;
+    endpoint_indices.findKey(vertex, index, exists);
+    if (!exists) {
+      index = endpoint_divs.size();
+      endpoint_indices[vertex] = index;
+      endpoint_divs.push_back(DiversionSeq());
+    }
+    endpoint_divs[index].push_back(div);
+  }
+
+  size_t endpoint_count = endpoint_divs.size();
+  Vector<PathEndSeq> endpoint_ends(endpoint_count);
+  for (size_t i = 0; i < endpoint_count; i++) {
+    dispatch_queue_->dispatch([this, i, &endpoint_divs, &endpoint_ends](int) {
+      enumEndpoint(endpoint_divs[i], endpoint_ends[i]);
+    });
+  }
+  dispatch_queue_->finishTasks();
+
+  for (PathEndSeq &ends : endpoint_ends)
+    endpoint_ends_.insert(endpoint_ends_.end(), ends.begin(), ends.end());
+  sort(endpoint_ends_, [this](const PathEnd *path_end1,
+			      const PathEnd *path_end2) {
+    return PathEnd::cmp(path_end1, path_end2, this) < 0;
+  });
+  if (static_cast<int>(endpoint_ends_.size()) > group_count_) {
+    for (size_t i = group_count_; i < endpoint_ends_.size(); i++)
+      delete endpoint_ends_[i];
+    endpoint_ends_.resize(group_count_);
+  }
+}
+
+void
+PathEnum::enumEndpoint(DiversionSeq &divs,
+		       // Return value.
+		       PathEndSeq &path_ends)
+{
+  PathEnum path_enum(endpoint_count_, endpoint_count_, unique_pins_,
+		     cmp_slack_, this);
+  // Enumerate in the calling thread.
+  path_enum.thread_count_ = 1;
+  // Inserts were pruned by this PathEnum.
+  path_enum.inserts_pruned_ = true;
+  path_enum.threshold_ = threshold_;
+  path_enum.have_threshold_ = have_threshold_;
+  for (Diversion *div : divs) {
+    path_enum.insert(div->pathEnd());
+    delete div;
+  }
+  while (path_enum.hasNext())
+    path_ends.push_back(path_enum.next());
+}
+
+// Find the slack/arrival of the group_count'th diversion in divs that
+// can still be reported. Diversions that are not as bad will never be
+// reported. With unique pins only one pending diversion per endpoint
+// survives pruneDiversionQueue, so the others are not counted.
+void
+PathEnum::setThreshold(const DiversionSeq &divs)
+{
+  int path_count = 0;
+  VertexPathCountMap::Iterator count_iter(path_counts_);
+  while (count_iter.hasNext()) {
+    Vertex *vertex;
+    int count;
+    count_iter.next(vertex, count);
+    path_count += std::min(count, endpoint_count_);
+  }
+  VertexPathCountMap div_counts;
+  for (Diversion *div : divs) {
+    PathEnd *path_end = div->pathEnd();
+    Vertex *vertex = path_end->vertex(this);
+    int count;
+    bool exists;
+    path_counts_.findKey(vertex, count, exists);
+    if (!exists)
+      count = 0;
+    int div_count = div_counts[vertex];
+    if (count + div_count < endpoint_count_
+	&& (!unique_pins_ || div_count == 0)) {
+      div_counts[vertex]++;
+      path_count++;
+      if (path_count == group_count_) {
+	Delay threshold = cmp_slack_
+	  ? path_end->slack(this)
+	  : path_end->dataArrivalTime(this);
+	if (!have_threshold_
+	    || divSavable(threshold, path_end->minMax(this))) {
+	  threshold_ = threshold;
+	  have_threshold_ = true;
+	}
+	break;
+      }
+    }
+  }
+}
+
+// True if a diversion with slack/arrival div_delay can be one of the
+// group_count paths.
+bool
+PathEnum::divSavable(const Delay &div_delay,
+		     const MinMax *min_max) const
+{
+  if (!have_threshold_)
+    return true;
+  else if (cmp_slack_)
+    return delayLessEqual(div_delay, threshold_, this);
+  else
+    return delayGreaterEqual(div_delay, threshold_, min_max, this);
+}
+
 void
 PathEnum::reportDiversionPath(Diversion *div)
 {
@@ -248,6 +397,8 @@ public:
 			       const PathAnalysisPt *path_ap);
 
 private:
+  bool divSavable(const Arrival &to_arrival,
+		  const MinMax *min_max) const;
   void makeDivertedPathEnd(Path *after_div,
 			   TimingArc *div_arc,
 			   // Return values.
@@ -258,6 +409,8 @@ private:
 
   PathEnd *path_end_;
   Slack path_end_slack_;
+  // Slack or data arrival compared by the path enumerator.
+  Delay path_end_delay_;
   PathRef &before_div_;
   bool unique_pins_;
   int before_div_rf_index_;
@@ -277,6 +430,9 @@ PathEnumFaninVisitor::PathEnumFaninVisitor(PathEnd *path_end,
   PathVisitor(path_enum),
   path_end_(path_end),
   path_end_slack_(path_end->slack(this)),
+  path_end_delay_(path_enum->cmp_slack_
+		  ? path_end_slack_
+		  : path_end->dataArrivalTime(this)),
   before_div_(before_div),
   unique_pins_(unique_pins),
   before_div_rf_index_(before_div_.rfIndex(this)),
@@ -343,7 +499,12 @@ PathEnumFaninVisitor::visitFromToPath(const Pin *,
       // Make the diverted path end to check slack with from_path crpr.
       makeDivertedPathEnd(from_path, arc, div_end, after_div_copy);
       // Only enumerate paths with greater slack.
-      if (delayGreaterEqual(div_end->slack(this), path_end_slack_, this)) {
+      Slack div_slack = div_end->slack(this);
+      if (delayGreaterEqual(div_slack, path_end_slack_, this)
+	  && path_enum_->divSavable(path_enum_->cmp_slack_
+				    ? div_slack
+				    : div_end->dataArrivalTime(this),
+				    min_max)) {
 	reportDiversion(arc, from_path);
 	path_enum_->makeDiversion(div_end, after_div_copy);
       }
@@ -351,7 +512,8 @@ PathEnumFaninVisitor::visitFromToPath(const Pin *,
 	delete div_end;
     }
     // Only enumerate slower/faster paths.
-    else if (delayLessEqual(to_arrival, before_div_arrival_, min_max, this)) {
+    else if (delayLessEqual(to_arrival, before_div_arrival_, min_max, this)
+	     && divSavable(to_arrival, min_max)) {
       PathEnd *div_end;
       PathEnumed *after_div_copy;
       makeDivertedPathEnd(from_path, arc, div_end, after_div_copy);
@@ -362,6 +524,26 @@ PathEnumFaninVisitor::visitFromToPath(const Pin *,
   return true;
 }
 
+// Check the diversion slack/arrival before making the diverted path.
+// The diversion changes the arrivals after before_div by the same
+// amount, except for latch checks where borrowing absorbs the change.
+bool
+PathEnumFaninVisitor::divSavable(const Arrival &to_arrival,
+				 const MinMax *min_max) const
+{
+  if (path_end_->isLatchCheck())
+    return true;
+  Arrival delta = to_arrival - before_div_arrival_;
+  Delay div_delay;
+  if (!path_enum_->cmp_slack_)
+    div_delay = path_end_delay_ + delta;
+  else if (min_max == MinMax::max())
+    div_delay = path_end_delay_ - delta;
+  else
+    div_delay = path_end_delay_ + delta;
+  return path_enum_->divSavable(div_delay, min_max);
+}
+
 void
 PathEnumFaninVisitor::makeDivertedPathEnd(Path *after_div,
 					  TimingArc *div_arc,
@@ -447,6 +629,7 @@ PathEnum::pruneDiversionQueue()
     div_queue_.pop();
   }
 
+  setThreshold(divs);
   // Add the top diversions back.
   DiversionSeq::Iterator div_iter(divs);
   while (div_iter.hasNext()) {
@@ -49,6 +49,8 @@ private:
 };
 
 // Iterator to enumerate sucessively slower paths.
+// With multiple threads the paths for each endpoint are enumerated in
+// parallel and merged.
 class PathEnum : public Iterator<PathEnd*>, StaState
 {
 public:
@@ -68,6 +70,13 @@ private:
 		      Path *before);
   void makeDiversion(PathEnd *div_end,
 		     PathEnumed *after_div_copy);
+  bool divSavable(const Delay &div_delay,
+		  const MinMax *min_max) const;
+  void setThreshold(const DiversionSeq &divs);
+  void enumEndpoints();
+  void enumEndpoint(DiversionSeq &divs,
+		    // Return value.
+		    PathEndSeq &path_ends);
   void makeDivertedPath(Path *path,
 			Path *before_div,
 			Path *after_div,
@@ -97,6 +106,13 @@ private:
   VertexPathCountMap path_counts_;
   bool inserts_pruned_;
   PathEnd *next_;
+  // Slack/arrival of the group_count'th path known to be reportable.
+  // Diversions that cannot beat it are not made.
+  Delay threshold_;
+  bool have_threshold_;
+  // Path ends enumerated for all endpoints in parallel, in order.
+  PathEndSeq endpoint_ends_;
+  size_t endpoint_end_index_;
 
   friend class PathEnumFaninVisitor;
 };
@@ -119,7 +119,7 @@ PathEnumed::setArrival(Arrival arrival,
   arrival_ = arrival;
 }
 
-const Required &
+Required
 PathEnumed::required(const StaState *sta) const
 {
   // Required times are never needed for enumerated paths.
@@ -40,7 +40,7 @@ public:
   virtual PathAPIndex pathAnalysisPtIndex(const StaState *sta) const;
   virtual Arrival arrival(const StaState *sta) const;
   virtual void setArrival(Arrival arrival, const StaState *sta);
-  virtual const Required &required(const StaState *sta) const;
+  virtual Required required(const StaState *sta) const;
   virtual void setRequired(const Required &required,
 			   const StaState *sta);
   virtual Path *prevPath(const StaState *sta) const;
@@ -128,6 +128,17 @@ PathGroup::insert(PathEnd *path_end)
     prune();
 }
 
+// Merge path ends collected by each thread.
+void
+PathGroup::insert(const PathEndSeq &path_ends)
+{
+  UniqueLock lock(lock_);
+  path_ends_.insert(path_ends_.end(), path_ends.begin(), path_ends.end());
+  if (group_count_ != group_count_max
+      && static_cast<int>(path_ends_.size()) > group_count_ * 2)
+    prune();
+}
+
 void
 PathGroup::prune()
 {
@@ -513,14 +524,106 @@ PathGroups::makePathEnds(ExceptionTo *to,
 
 ////////////////////////////////////////////////////////////////
 
+// Each thread's copy of the visitor keeps the worst group_count path
+// ends for each group in a heap so path ends are collected without
+// locking the groups. The heaps are merged into the groups when the
+// endpoints have all been visited.
+class MakePathEnds : public PathEndVisitor
+{
+public:
+  MakePathEnds(PathGroups *path_groups);
+  MakePathEnds(const MakePathEnds &make_path_ends);
+  virtual ~MakePathEnds();
+  virtual MakePathEnds *copy() const = 0;
+  void mergeGroupEnds();
+
+protected:
+  void insert(PathGroup *group,
+	      PathEnd *path_end);
+
+  PathGroups *path_groups_;
+  PathGroupEndsMap group_ends_;
+  PathEndLess cmp_;
+};
+
+MakePathEnds::MakePathEnds(PathGroups *path_groups) :
+  path_groups_(path_groups),
+  cmp_(path_groups)
+{
+}
+
+// Copies start with empty heaps.
+MakePathEnds::MakePathEnds(const MakePathEnds &make_path_ends) :
+  PathEndVisitor(),
+  path_groups_(make_path_ends.path_groups_),
+  cmp_(make_path_ends.path_groups_)
+{
+}
+
+MakePathEnds::~MakePathEnds()
+{
+  PathGroupEndsMap::Iterator group_iter(group_ends_);
+  while (group_iter.hasNext()) {
+    PathGroup *group;
+    PathEndSeq *ends;
+    group_iter.next(group, ends);
+    ends->deleteContents();
+    delete ends;
+  }
+}
+
+void
+MakePathEnds::insert(PathGroup *group,
+		     PathEnd *path_end)
+{
+  PathEndSeq *ends = group_ends_.findKey(group);
+  if (ends == nullptr) {
+    ends = new PathEndSeq;
+    group_ends_[group] = ends;
+  }
+  int group_count = group->maxPaths();
+  if (group_count == PathGroup::group_count_max)
+    ends->push_back(path_end);
+  else if (static_cast<int>(ends->size()) < group_count) {
+    ends->push_back(path_end);
+    std::push_heap(ends->begin(), ends->end(), cmp_);
+  }
+  // The heap front is the best of the worst path ends.
+  else if (cmp_(path_end, ends->front())) {
+    std::pop_heap(ends->begin(), ends->end(), cmp_);
+    delete ends->back();
+    ends->back() = path_end;
+    std::push_heap(ends->begin(), ends->end(), cmp_);
+  }
+  else
+    delete path_end;
+}
+
+void
+MakePathEnds::mergeGroupEnds()
+{
+  PathGroupEndsMap::Iterator group_iter(group_ends_);
+  while (group_iter.hasNext()) {
+    PathGroup *group;
+    PathEndSeq *ends;
+    group_iter.next(group, ends);
+    // The group owns the path ends now.
+    group->insert(*ends);
+    delete ends;
+  }
+  group_ends_.clear();
+}
+
+////////////////////////////////////////////////////////////////
+
 // Visit each path end for a vertex and add the worst one in each
 // path group to the group.
-class MakePathEnds1 : public PathEndVisitor
+class MakePathEnds1 : public MakePathEnds
 {
 public:
   MakePathEnds1(PathGroups *path_groups);
   MakePathEnds1(const MakePathEnds1&) = default;
-  virtual PathEndVisitor *copy() const;
+  virtual MakePathEnds *copy() const;
   virtual void visit(PathEnd *path_end);
   virtual void vertexEnd(Vertex *vertex);
 
@@ -528,18 +631,15 @@ private:
   void visitPathEnd(PathEnd *path_end,
 		    PathGroup *group);
 
-  PathGroups *path_groups_;
   PathGroupEndMap ends_;
-  PathEndLess cmp_;
 };
 
 MakePathEnds1::MakePathEnds1(PathGroups *path_groups) :
-  path_groups_(path_groups),
-  cmp_(path_groups)
+  MakePathEnds(path_groups)
 {
 }
 
-PathEndVisitor *
+MakePathEnds *
 MakePathEnds1::copy() const
 {
   return new MakePathEnds1(*this);
@@ -582,7 +682,7 @@ MakePathEnds1::vertexEnd(Vertex *)
     group_iter.next(group, end);
     // visitPathEnd already confirmed slack is savable.
     if (end) {
-      group->insert(end);
+      insert(group, end);
       // Clear ends_ for next vertex.
       ends_[group] = nullptr;
     }
@@ -594,14 +694,14 @@ MakePathEnds1::vertexEnd(Vertex *)
 // Visit each path end and add it to the corresponding path group.
 // After collecting the ends do parallel path enumeration to find the
 // path ends for the group.
-class MakePathEndsAll : public PathEndVisitor
+class MakePathEndsAll : public MakePathEnds
 {
 public:
   MakePathEndsAll(int endpoint_count,
                   PathGroups *path_groups);
   MakePathEndsAll(const MakePathEndsAll&) = default;
   virtual ~MakePathEndsAll();
-  virtual PathEndVisitor *copy() const;
+  virtual MakePathEnds *copy() const;
   virtual void visit(PathEnd *path_end);
   virtual void vertexEnd(Vertex *vertex);
 
@@ -610,7 +710,6 @@ private:
 		    PathGroup *group);
 
   int endpoint_count_;
-  PathGroups *path_groups_;
   const StaState *sta_;
   PathGroupEndsMap ends_;
   PathEndSlackLess slack_cmp_;
@@ -619,16 +718,15 @@ private:
 
 MakePathEndsAll::MakePathEndsAll(int endpoint_count,
 				 PathGroups *path_groups) :
+  MakePathEnds(path_groups),
   endpoint_count_(endpoint_count),
-  path_groups_(path_groups),
   sta_(path_groups),
   slack_cmp_(path_groups),
   path_no_crpr_cmp_(path_groups)
 {
 }
 
-
-PathEndVisitor *
+MakePathEnds *
 MakePathEndsAll::copy() const
 {
   return new MakePathEndsAll(*this);
@@ -694,7 +792,7 @@ MakePathEndsAll::vertexEnd(Vertex *)
 	  // Give the group a copy of the path end because
 	  // it may delete it during pruning.
 	  if (group->savable(path_end)) {
-	    group->insert(path_end->copy());
+	    insert(group, path_end->copy());
 	    unique_ends.insert(path_end);
 	    n++;
 	  }
@@ -799,7 +897,7 @@ void
 PathGroups::makeGroupPathEnds(ExceptionTo *to,
 			      const Corner *corner,
 			      const MinMaxAll *min_max,
-			      PathEndVisitor *visitor)
+			      MakePathEnds *visitor)
 {
   Network *network = this->network();
   Graph *graph = this->graph();
@@ -840,7 +938,7 @@ exceptionToEmpty(ExceptionTo *to)
 class MakeEndpointPathEnds : public VertexVisitor
 {
 public:
-  MakeEndpointPathEnds(PathEndVisitor *path_end_visitor,
+  MakeEndpointPathEnds(MakePathEnds *path_end_visitor,
 		       const Corner *corner,
 		       const MinMaxAll *min_max,
 		       const StaState *sta);
@@ -848,16 +946,17 @@ public:
   ~MakeEndpointPathEnds();
   virtual VertexVisitor *copy() const;
   virtual void visit(Vertex *vertex);
+  void mergeGroupEnds();
 
 private:
   VisitPathEnds *visit_path_ends_;
-  PathEndVisitor *path_end_visitor_;
+  MakePathEnds *path_end_visitor_;
   const Corner *corner_;
   const MinMaxAll *min_max_;
   const StaState *sta_;
 };
 
-MakeEndpointPathEnds::MakeEndpointPathEnds(PathEndVisitor *path_end_visitor,
+MakeEndpointPathEnds::MakeEndpointPathEnds(MakePathEnds *path_end_visitor,
 					   const Corner *corner,
 					   const MinMaxAll *min_max,
 					   const StaState *sta) :
@@ -897,18 +996,25 @@ MakeEndpointPathEnds::visit(Vertex *vertex)
 				  path_end_visitor_);
 }
 
+void
+MakeEndpointPathEnds::mergeGroupEnds()
+{
+  path_end_visitor_->mergeGroupEnds();
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
 PathGroups::makeGroupPathEnds(VertexSet *endpoints,
 			      const Corner *corner,
 			      const MinMaxAll *min_max,
-			      PathEndVisitor *visitor)
+			      MakePathEnds *visitor)
 {
   if (thread_count_ == 1) {
     MakeEndpointPathEnds end_visitor(visitor, corner, min_max, this);
     for (auto endpoint : *endpoints)
       end_visitor.visit(endpoint);
+    end_visitor.mergeGroupEnds();
   }
   else {
     Vector<MakeEndpointPathEnds> visitors(thread_count_,
@@ -919,6 +1025,8 @@ PathGroups::makeGroupPathEnds(VertexSet *endpoints,
       { visitors[i].visit(endpoint); } );
     }
     dispatch_queue_->finishTasks();
+    for (auto &end_visitor : visitors)
+      end_visitor.mergeGroupEnds();
   }
 }
 
@@ -215,7 +215,7 @@ PathRef::setArrival(Arrival arrival,
     return path_vertex_.setArrival(arrival, sta);
 }
 
-const Required &
+Required
 PathRef::required(const StaState *sta) const
 {
   if (path_enumed_)
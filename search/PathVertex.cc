@@ -16,6 +16,7 @@
 
 #include "PathVertex.hh"
 
+#include <algorithm>
 #include <cmath>
 
 #include "Fuzzy.hh"
@@ -229,9 +230,8 @@ PathVertex::setArrivalIndex(int arrival_index)
 Arrival
 PathVertex::arrival(const StaState *sta) const
 {
-  Arrival *arrivals = sta->graph()->arrivals(vertex_);
-  if (arrivals)
-    return arrivals[arrival_index_];
+  if (vertex_->hasArrivals())
+    return sta->graph()->arrival(vertex_, arrival_index_);
   else {
     sta->report()->error(620, "missing arrivals.");
     return 0.0;
@@ -243,22 +243,18 @@ PathVertex::setArrival(Arrival arrival,
 		       const StaState *sta)
 {
   if (tag_) {
-    Arrival *arrivals = sta->graph()->arrivals(vertex_);
-    if (arrivals)
-      arrivals[arrival_index_] = arrival;
+    if (vertex_->hasArrivals())
+      sta->graph()->setArrival(vertex_, arrival_index_, arrival);
     else
       sta->report()->error(621, "missing arrivals.");
   }
 }
 
-const Required &
+Required
 PathVertex::required(const StaState *sta) const
 {
-  if (tag_) {
-    Required *requireds = sta->graph()->requireds(vertex_);
-    if (requireds)
-      return requireds[arrival_index_];
-  }
+  if (tag_ && vertex_->hasRequireds())
+    return sta->graph()->required(vertex_, arrival_index_);
   return delayInitValue(minMax(sta)->opposite());
 }
 
@@ -267,18 +263,19 @@ PathVertex::setRequired(const Required &required,
 			const StaState *sta)
 {
   Graph *graph = sta->graph();
-  Required *requireds = graph->requireds(vertex_);
-  if (requireds == nullptr) {
+  if (!vertex_->hasRequireds()) {
     const Search *search = sta->search();
     TagGroup *tag_group = search->tagGroup(vertex_);
     if (tag_group) {
       int arrival_count = tag_group->arrivalCount();
-      requireds = graph->makeRequireds(vertex_, arrival_count);
+      graph->makeRequireds(vertex_, arrival_count);
     }
-    else
+    else {
       sta->report()->error(622, "missing requireds.");
+      return;
+    }
   }
-  requireds[arrival_index_] = required;
+  graph->setRequired(vertex_, arrival_index_, required);
 }
 
 bool
@@ -350,7 +347,7 @@ protected:
   PathAPIndex path_ap_index_;
   PathVertex prev_path_;
   TimingArc *prev_arc_;
-  float dcalc_tol_;
+  float arrival_tol_;
 };
 
 PrevPathVisitor::PrevPathVisitor(const Path *path,
@@ -364,7 +361,10 @@ PrevPathVisitor::PrevPathVisitor(const Path *path,
   path_ap_index_(path->pathAnalysisPtIndex(sta)),
   prev_path_(),
   prev_arc_(nullptr),
-  dcalc_tol_(sta->graphDelayCalc()->incrementalDelayTolerance())
+  // Arrivals that change less than the search tolerance are not
+  // updated, so the previous arrival may differ by that much.
+  arrival_tol_(std::max(sta->graphDelayCalc()->incrementalDelayTolerance(),
+			sta->search()->arrivalTolerance()))
 {
 }
 
@@ -376,14 +376,14 @@ PrevPathVisitor::copy() const
 
 bool
 PrevPathVisitor::visitFromToPath(const Pin *,
-				 Vertex *,
+				 Vertex *from_vertex,
 				 const RiseFall *,
 				 Tag *from_tag,
 				 PathVertex *from_path,
 				 Edge *,
 				 TimingArc *arc,
 				 ArcDelay,
-				 Vertex *,
+				 Vertex *to_vertex,
 				 const RiseFall *to_rf,
 				 Tag *to_tag,
 				 Arrival &to_arrival,
@@ -391,10 +391,13 @@ PrevPathVisitor::visitFromToPath(const Pin *,
 				 const PathAnalysisPt *path_ap)
 {
   PathAPIndex path_ap_index = path_ap->index();
+  float arrival_tol = arrival_tol_
+    + graph_->arrivalResolution(from_vertex)
+    + graph_->arrivalResolution(to_vertex);
   if (to_rf->index() == path_rf_index_
       && path_ap_index == path_ap_index_
-      && (dcalc_tol_ > 0.0 
-	  ? std::abs(delayAsFloat(to_arrival - path_arrival_)) < dcalc_tol_
+      && (arrival_tol > 0.0
+	  ? std::abs(delayAsFloat(to_arrival - path_arrival_)) <= arrival_tol
 	  : delayEqual(to_arrival, path_arrival_))
       && (tagMatch(to_tag, path_tag_, this)
 	  // If the filter exception became active searching from
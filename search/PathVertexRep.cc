@@ -143,9 +143,8 @@ PathVertexRep::arrival(const StaState *sta) const
     tag_group->arrivalIndex(tag, arrival_index, arrival_exists);
     if (!arrival_exists)
       sta->report()->critical(254, "tag group missing tag");
-    Arrival *arrivals = graph->arrivals(vertex);
-    if (arrivals)
-      return arrivals[arrival_index];
+    if (vertex->hasArrivals())
+      return graph->arrival(vertex, arrival_index);
     else
       sta->report()->critical(624, "missing arrivals");
   }
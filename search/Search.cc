@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <cmath> // abs
+#include <limits>
 
 #include "Mutex.hh"
 #include "Report.hh"
@@ -251,6 +252,12 @@ Search::init(StaState *sta)
   filter_from_ = nullptr;
   filter_to_ = nullptr;
   found_downstream_clk_pins_ = false;
+  arrival_visit_count_ = 0;
+  required_visit_count_ = 0;
+  exception_pt_levels_valid_ = false;
+  pruned_exception_state_count_ = 0;
+  invalid_defer_count_ = 0;
+  invalid_deferred_ = false;
 }
 
 // Init "options".
@@ -260,6 +267,8 @@ Search::initVars()
   unconstrained_paths_ = false;
   crpr_path_pruning_enabled_ = true;
   crpr_approx_missing_requireds_ = true;
+  arrival_tolerance_ = 0.0;
+  prune_exception_states_ = false;
 }
 
 Search::~Search()
@@ -316,6 +325,11 @@ Search::clear()
   deleteFilter();
   genclks_->clear();
   found_downstream_clk_pins_ = false;
+  clearVisitCounts();
+  exception_pt_levels_.clear();
+  exception_pt_levels_valid_ = false;
+  pruned_exception_state_count_ = 0;
+  invalid_deferred_ = false;
 }
 
 bool
@@ -342,6 +356,31 @@ Search::setCrprApproxMissingRequireds(bool enabled)
   crpr_approx_missing_requireds_ = enabled;
 }
 
+void
+Search::setArrivalTolerance(float tol)
+{
+  arrival_tolerance_ = tol;
+}
+
+void
+Search::clearVisitCounts()
+{
+  arrival_visit_count_ = 0;
+  required_visit_count_ = 0;
+}
+
+void
+Search::setPruneExceptionStates(bool prune)
+{
+  prune_exception_states_ = prune;
+}
+
+size_t
+Search::prunedExceptionStateCount() const
+{
+  return pruned_exception_state_count_;
+}
+
 void
 Search::deleteTags()
 {
@@ -358,6 +397,8 @@ Search::deleteTags()
   tag_free_indices_.clear();
 
   clk_info_set_->deleteContentsClear();
+  // Tag indices are reused.
+  check_crpr_->clkPathsChanged();
 }
 
 void
@@ -415,6 +456,11 @@ Search::deletePaths(Vertex *vertex)
   tnsNotifyBefore(vertex);
   if (worst_slacks_)
     worst_slacks_->worstSlackNotifyBefore(vertex);
+  TagGroup *tag_group = tagGroup(vertex);
+  if (tag_group
+      && (tag_group->hasClkTag()
+	  || tag_group->hasGenClkSrcTag()))
+    check_crpr_->clkPathsChanged();
   vertex->deletePaths();
 }
 
@@ -468,11 +514,25 @@ Search::findFilteredArrivals(ExceptionFrom *from,
                              ExceptionTo *to,
                              bool unconstrained)
 {
-  unconstrained_paths_ = unconstrained;
   // Delete results from last findPathEnds.
-  // Filtered arrivals are deleted by Sta::searchPreamble.
+  // Filtered arrivals are deleted by Sta::searchPreamble unless
+  // they can be reused.
   deletePathGroups();
   checkFromThrusTo(from, thrus, to);
+  if (filter_
+      && filteredArrivalsReusable(from, thrus, unconstrained)) {
+    // The filtered arrivals from the last search are still valid.
+    debugPrint(debug_, "search", 1, "reuse filtered arrivals");
+    delete from;
+    if (thrus) {
+      thrus->deleteContents();
+      delete thrus;
+    }
+    delete filter_to_;
+    filter_to_ = to;
+    return;
+  }
+  unconstrained_paths_ = unconstrained;
   filter_from_ = from;
   filter_to_ = to;
   if ((from
@@ -523,6 +583,34 @@ Search::deleteFilteredArrivals()
   deleteFilter();
 }
 
+// Filtered arrivals are only valid until arrivals are invalidated
+// by a timing change. Unconstrained paths change the arrival seeds
+// and endpoints so they have to match too.
+bool
+Search::filteredArrivalsReusable(ExceptionFrom *from,
+				 ExceptionThruSeq *thrus,
+				 bool unconstrained)
+{
+  if (filter_ == nullptr
+      || !arrivalsValid()
+      || unconstrained != unconstrained_paths_)
+    return false;
+  ExceptionFrom *filter_from = filter_->from();
+  if (!((from == nullptr && filter_from == nullptr)
+	|| (from && filter_from && from->equal(filter_from))))
+    return false;
+  ExceptionThruSeq *filter_thrus = filter_->thrus();
+  size_t thru_count = thrus ? thrus->size() : 0;
+  size_t filter_thru_count = filter_thrus ? filter_thrus->size() : 0;
+  if (thru_count != filter_thru_count)
+    return false;
+  for (size_t i = 0; i < thru_count; i++) {
+    if (!(*thrus)[i]->equal((*filter_thrus)[i]))
+      return false;
+  }
+  return true;
+}
+
 void
 Search::deleteFilterTagGroups()
 {
@@ -551,6 +639,7 @@ Search::deleteFilterTags()
       tag_free_indices_.push_back(i);
     }
   }
+  check_crpr_->clkPathsChanged();
 }
 
 void
@@ -581,6 +670,7 @@ Search::findFilteredArrivals()
     debugPrint(debug_, "search", 1, "find arrivals pass %d", pass);
     int arrival_count = arrival_iter_->visitParallel(max_level,
 						     arrival_visitor_);
+    arrival_visit_count_ += arrival_count;
     debugPrint(debug_, "search", 1, "found %d arrivals", arrival_count);
   }
   arrivals_exist_ = true;
@@ -668,11 +758,27 @@ bool
 Search::arrivalsValid()
 {
   return arrivals_exist_
-    && invalid_arrivals_->empty();
+    && invalid_arrivals_->empty()
+    && !invalid_deferred_;
 }
 
 void
 Search::arrivalsInvalid()
+{
+  if (invalid_defer_count_ > 0) {
+    debugPrint(debug_, "search", 2, "arrivals invalid deferred");
+    invalid_deferred_ = true;
+    // The flush discards vertex invalidations, so stop recording them.
+    invalid_arrivals_->clear();
+    invalid_requireds_->clear();
+    invalid_tns_->clear();
+  }
+  else
+    arrivalsInvalid1();
+}
+
+void
+Search::arrivalsInvalid1()
 {
   if (arrivals_exist_) {
     debugPrint(debug_, "search", 1, "arrivals invalid");
@@ -697,6 +803,9 @@ Search::arrivalsInvalid()
     clearWorstSlack();
     invalid_tns_->clear();
   }
+  // Levels are found again with the next search.
+  exception_pt_levels_valid_ = false;
+  pruned_exception_state_count_ = 0;
 }
 
 void
@@ -714,7 +823,8 @@ Search::requiredsInvalid()
 void
 Search::arrivalInvalid(Vertex *vertex)
 {
-  if (arrivals_exist_) {
+  if (arrivals_exist_
+      && !invalid_deferred_) {
     debugPrint(debug_, "search", 2, "arrival invalid %s",
                vertex->name(sdc_network_));
     if (!arrival_iter_->inQueue(vertex)) {
@@ -737,6 +847,10 @@ void
 Search::levelChangedBefore(Vertex *vertex)
 {
   if (arrivals_exist_) {
+    if (exception_pt_levels_valid_)
+      // Exception states pruned with the previous levels may
+      // be reachable with the new levels.
+      arrivalsInvalid();
     arrival_iter_->remove(vertex);
     required_iter_->remove(vertex);
     search_->arrivalInvalid(vertex);
@@ -784,7 +898,8 @@ Search::requiredInvalid(const Pin *pin)
 void
 Search::requiredInvalid(Vertex *vertex)
 {
-  if (requireds_exist_) {
+  if (requireds_exist_
+      && !invalid_deferred_) {
     debugPrint(debug_, "search", 2, "required invalid %s",
                vertex->name(sdc_network_));
     if (!required_iter_->inQueue(vertex)) {
@@ -798,9 +913,38 @@ Search::requiredInvalid(Vertex *vertex)
 
 ////////////////////////////////////////////////////////////////
 
+void
+Search::deferInvalidBegin()
+{
+  invalid_defer_count_++;
+}
+
+void
+Search::deferInvalidEnd()
+{
+  if (invalid_defer_count_ > 0) {
+    invalid_defer_count_--;
+    if (invalid_defer_count_ == 0)
+      deferredInvalidFlush();
+  }
+}
+
+void
+Search::deferredInvalidFlush()
+{
+  if (invalid_deferred_) {
+    invalid_deferred_ = false;
+    debugPrint(debug_, "search", 1, "deferred arrivals invalid");
+    arrivalsInvalid1();
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
 void
 Search::findClkArrivals()
 {
+  deferredInvalidFlush();
   if (!clk_arrivals_valid_) {
     genclks_->ensureInsertionDelays();
     Stats stats(debug_, report_);
@@ -814,6 +958,7 @@ Search::findClkArrivals()
     stats.report("Find clk arrivals");
   }
   clk_arrivals_valid_ = true;
+  check_crpr_->ensureClkTree();
 }
 
 void
@@ -876,8 +1021,7 @@ Search::visitStartpoints(VertexVisitor *visitor)
   }
   delete pin_iter;
 
-  for (auto iter : sdc_->inputDelayPinMap()) {
-    const Pin *pin = iter.first;
+  for (const Pin *pin : sdc_->inputDelayPins()) {
     // Already hit these.
     if (!network_->isTopLevelPort(pin)) {
       Vertex *vertex = graph_->pinDrvrVertex(pin);
@@ -982,6 +1126,7 @@ Search::findArrivals(Level level,
   findArrivals1();
   Stats stats(debug_, report_);
   int arrival_count = arrival_iter_->visitParallel(level, arrival_visitor);
+  arrival_visit_count_ += arrival_count;
   stats.report("Find arrivals");
   if (arrival_iter_->empty()
       && invalid_arrivals_->empty()) {
@@ -989,12 +1134,17 @@ Search::findArrivals(Level level,
     arrivals_at_endpoints_exist_ = true;
   }
   arrivals_exist_ = true;
+  check_crpr_->ensureClkTree();
   debugPrint(debug_, "search", 1, "found %u arrivals", arrival_count);
 }
 
 void
 Search::findArrivals1()
 {
+  deferredInvalidFlush();
+  if (prune_exception_states_
+      && !exception_pt_levels_valid_)
+    findExceptionPtLevels();
   if (!arrivals_seeded_) {
     genclks_->ensureInsertionDelays();
     arrival_iter_->clear();
@@ -1180,24 +1330,26 @@ bool
 Search::arrivalsChanged(Vertex *vertex,
 			TagGroupBldr *tag_bldr)
 {
-  Arrival *arrivals1 = graph_->arrivals(vertex);
-  if (arrivals1) {
+  if (vertex->hasArrivals()) {
     TagGroup *tag_group = tagGroup(vertex);
     if (tag_group == nullptr
         || tag_group->arrivalMap()->size() != tag_bldr->arrivalMap()->size())
       return true;
+    // Stored arrivals may differ from the values set by the resolution.
+    float tolerance = std::max(arrival_tolerance_,
+			       graph_->arrivalResolution(vertex));
     ArrivalMap::Iterator arrival_iter1(tag_group->arrivalMap());
     while (arrival_iter1.hasNext()) {
       Tag *tag1;
       int arrival_index1;
       arrival_iter1.next(tag1, arrival_index1);
-      Arrival &arrival1 = arrivals1[arrival_index1];
+      Arrival arrival1 = graph_->arrival(vertex, arrival_index1);
       Tag *tag2;
       Arrival arrival2;
       int arrival_index2;
       tag_bldr->tagMatchArrival(tag1, tag2, arrival2, arrival_index2);
       if (tag2 != tag1
-	  || !delayEqual(arrival1, arrival2))
+	  || arrivalChanged(arrival1, arrival2, tolerance))
 	return true;
     }
     return false;
@@ -1206,6 +1358,17 @@ Search::arrivalsChanged(Vertex *vertex,
     return true;
 }
 
+bool
+Search::arrivalChanged(const Arrival &arrival1,
+		       const Arrival &arrival2,
+		       float tolerance) const
+{
+  if (tolerance > 0.0)
+    return std::abs(delayAsFloat(arrival1 - arrival2)) > tolerance;
+  else
+    return !delayEqual(arrival1, arrival2);
+}
+
 bool
 ArrivalVisitor::visitFromToPath(const Pin *,
 				Vertex *from_vertex,
@@ -1646,8 +1809,7 @@ Search::seedInputArrivals(ClockSet *clks)
 {
   // Input arrivals can be on internal pins, so iterate over the pins
   // that have input arrivals rather than the top level input pins.
-  for (auto iter : sdc_->inputDelayPinMap()) {
-    const Pin *pin = iter.first;
+  for (const Pin *pin : sdc_->inputDelayPins()) {
     if (!sdc_->isLeafPinClock(pin)) {
       Vertex *vertex = graph_->pinDrvrVertex(pin);
       seedInputArrival(pin, vertex, clks);
@@ -2503,13 +2665,17 @@ Search::mutateTag(Tag *from_tag,
 {
   ExceptionStateSet *new_states = nullptr;
   ExceptionStateSet *from_states = from_tag->states();
+  // Most edges are not on any exception -thru so the states do not
+  // have to be matched against them.
+  bool thru_edge = sdc_->isExceptionThruEdge(from_pin, to_pin);
   if (from_states) {
     // Check for state changes in from_tag (but postpone copying state set).
     bool state_change = false;
     for (auto state : *from_states) {
       ExceptionPath *exception = state->exception();
       // One edge may traverse multiple hierarchical thru pins.
-      while (state->matchesNextThru(from_pin,to_pin,to_rf,min_max,network_)) {
+      while (thru_edge
+	     && state->matchesNextThru(from_pin,to_pin,to_rf,min_max,network_)) {
         // Found a -thru that we've been waiting for.
         state = state->nextState();
 	state_change = true;
@@ -2541,7 +2707,8 @@ Search::mutateTag(Tag *from_tag,
     }
 
     // Get the set of -thru exceptions starting at to_pin/edge.
-    new_states = sdc_->exceptionThruStates(from_pin, to_pin, to_rf, min_max);
+    if (thru_edge)
+      new_states = sdc_->exceptionThruStates(from_pin, to_pin, to_rf, min_max);
     if (new_states || state_change) {
       // Second pass to apply state changes and add updated existing
       // states to new states.
@@ -2550,7 +2717,8 @@ Search::mutateTag(Tag *from_tag,
       for (auto state : *from_states) {
 	ExceptionPath *exception = state->exception();
 	// One edge may traverse multiple hierarchical thru pins.
-	while (state->matchesNextThru(from_pin,to_pin,to_rf,min_max,network_))
+	while (thru_edge
+	       && state->matchesNextThru(from_pin,to_pin,to_rf,min_max,network_))
 	  // Found a -thru that we've been waiting for.
 	  state = state->nextState();
 
@@ -2577,10 +2745,41 @@ Search::mutateTag(Tag *from_tag,
       }
     }
   }
-  else
+  else if (thru_edge)
     // Get the set of -thru exceptions starting at to_pin/edge.
     new_states = sdc_->exceptionThruStates(from_pin, to_pin, to_rf, min_max);
 
+  if (exception_pt_levels_valid_
+      && !exception_pt_levels_.empty()) {
+    ExceptionStateSet *states = new_states ? new_states : from_states;
+    if (states) {
+      Level to_level = pinLevel(to_pin, MinMax::min());
+      size_t dead_count = 0;
+      for (ExceptionState *state : *states) {
+	if (isDeadState(state, to_level))
+	  dead_count++;
+      }
+      if (dead_count > 0) {
+	pruned_exception_state_count_ += dead_count;
+	ExceptionStateSet *live_states = nullptr;
+	if (dead_count < states->size()) {
+	  live_states = new ExceptionStateSet;
+	  for (ExceptionState *state : *states) {
+	    if (!isDeadState(state, to_level))
+	      live_states->insert(state);
+	  }
+	}
+	InputDelay *input_delay = new_states
+	  ? from_tag->inputDelay()
+	  : to_input_delay;
+	delete new_states;
+	return findTag(to_rf, path_ap, to_clk_info, to_is_clk,
+		       input_delay, to_is_segment_start,
+		       live_states, live_states != nullptr);
+      }
+    }
+  }
+
   if (new_states)
     return findTag(to_rf, path_ap, to_clk_info, to_is_clk,
 		   from_tag->inputDelay(), to_is_segment_start,
@@ -2600,6 +2799,84 @@ Search::mutateTag(Tag *from_tag,
   }
 }
 
+// Find the highest level of the -thru/-to pins of each exception.
+// Paths cannot reach a pin with a lower level than the path vertex,
+// so exception states waiting for those pins can be removed from tags.
+void
+Search::findExceptionPtLevels()
+{
+  exception_pt_levels_.clear();
+  // Dynamic loop breaking searches thru edges to lower levels.
+  if (!sdc_->dynamicLoopBreaking()) {
+    for (ExceptionPath *exception : *sdc_->exceptions()) {
+      ExceptionThruSeq *thrus = exception->thrus();
+      if (thrus) {
+	for (ExceptionThru *thru : *thrus)
+	  exception_pt_levels_[thru] = exceptionPtLevel(thru);
+      }
+      ExceptionTo *to = exception->to();
+      if (to)
+	exception_pt_levels_[to] = exceptionPtLevel(to);
+    }
+  }
+  exception_pt_levels_valid_ = true;
+}
+
+Level
+Search::exceptionPtLevel(ExceptionPt *pt) const
+{
+  const Level level_max = std::numeric_limits<Level>::max();
+  if (pt->clks())
+    return level_max;
+  PinSet pins;
+  pt->allPins(network_, &pins);
+  Level max_level = 0;
+  for (Pin *pin : pins) {
+    // Hierarchical pins are matched by the edges that cross them.
+    if (network_->isHierarchical(pin))
+      return level_max;
+    max_level = std::max(max_level, pinLevel(pin, MinMax::max()));
+  }
+  return max_level;
+}
+
+Level
+Search::pinLevel(const Pin *pin,
+		 const MinMax *min_max) const
+{
+  Vertex *vertex, *bidirect_drvr_vertex;
+  graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
+  Level level = vertex ? vertex->level() : 0;
+  if (bidirect_drvr_vertex) {
+    Level drvr_level = bidirect_drvr_vertex->level();
+    level = (min_max == MinMax::max())
+      ? std::max(level, drvr_level)
+      : std::min(level, drvr_level);
+  }
+  return level;
+}
+
+// True if the state is waiting for a -thru/-to pin that cannot be
+// reached from a vertex at to_level.
+bool
+Search::isDeadState(ExceptionState *state,
+		    Level to_level) const
+{
+  ExceptionPath *exception = state->exception();
+  if (exception->isLoop()
+      || exception->isFilter())
+    return false;
+  ExceptionPt *pt = state->nextThru();
+  if (pt == nullptr)
+    pt = exception->to();
+  if (pt == nullptr)
+    return false;
+  Level pt_level;
+  bool exists;
+  exception_pt_levels_.findKey(pt, pt_level, exists);
+  return exists && pt_level < to_level;
+}
+
 TagGroup *
 Search::findTagGroup(TagGroupBldr *tag_bldr)
 {
@@ -2647,8 +2924,14 @@ Search::setVertexArrivals(Vertex *vertex,
     deletePaths(vertex);
   else {
     TagGroup *prev_tag_group = tagGroup(vertex);
-    Arrival *prev_arrivals = graph_->arrivals(vertex);
     PathVertexRep *prev_paths = graph_->prevPaths(vertex);
+    if (tag_bldr->hasClkTag()
+	|| tag_bldr->hasGenClkSrcTag()
+	|| (prev_tag_group
+	    && (prev_tag_group->hasClkTag()
+		|| prev_tag_group->hasGenClkSrcTag())))
+      // Clock paths used by crpr changed.
+      check_crpr_->clkPathsChanged();
 
     TagGroup *tag_group = findTagGroup(tag_bldr);
     int arrival_count = tag_group->arrivalCount();
@@ -2665,14 +2948,20 @@ Search::setVertexArrivals(Vertex *vertex,
 	prev_paths = nullptr;
 	vertex->setPrevPaths(prev_path_null);
       }
-      tag_bldr->copyArrivals(tag_group, prev_arrivals, prev_paths);
+      tag_bldr->copyArrivals(tag_group, vertex, prev_paths);
       vertex->setTagGroupIndex(tag_group->index());
 
       if (has_requireds) {
-	requiredInvalid(vertex);
-        if (tag_group != prev_tag_group)
+        if (tag_group != prev_tag_group) {
           // Requireds can only be reused if the tag group is unchanged.
+          requiredInvalid(vertex);
           graph_->deleteRequireds(vertex, prev_tag_group->arrivalCount());
+        }
+        // Requireds propagated from the fanout do not depend on the
+        // vertex arrivals, so they are still valid unless the vertex is
+        // an endpoint (latch borrowing, for example).
+        else if (isEndpoint(vertex))
+          requiredInvalid(vertex);
       }
     }
     else {
@@ -2684,11 +2973,11 @@ Search::setVertexArrivals(Vertex *vertex,
           graph_->deleteRequireds(vertex, prev_arrival_count);
         }
       }
-      Arrival *arrivals = graph_->makeArrivals(vertex, arrival_count);
+      graph_->makeArrivals(vertex, arrival_count);
       prev_paths = nullptr;
       if  (tag_bldr->hasClkTag() || tag_bldr->hasGenClkSrcTag())
 	prev_paths = graph_->makePrevPaths(vertex, arrival_count);
-      tag_bldr->copyArrivals(tag_group, arrivals, prev_paths);
+      tag_bldr->copyArrivals(tag_group, vertex, prev_paths);
 
       vertex->setTagGroupIndex(tag_group->index());
     }
@@ -2700,8 +2989,6 @@ Search::reportArrivals(Vertex *vertex) const
 {
   report_->reportLine("Vertex %s", vertex->name(sdc_network_));
   TagGroup *tag_group = tagGroup(vertex);
-  Arrival *arrivals = graph_->arrivals(vertex);
-  Required *requireds = graph_->requireds(vertex);
   if (tag_group) {
     report_->reportLine("Group %u", tag_group->index());
     ArrivalMap::Iterator arrival_iter(tag_group->arrivalMap());
@@ -2712,8 +2999,8 @@ Search::reportArrivals(Vertex *vertex) const
       PathAnalysisPt *path_ap = tag->pathAnalysisPt(this);
       const RiseFall *rf = tag->transition();
       const char *req = "?";
-      if (requireds)
-        req = delayAsString(requireds[arrival_index], this);
+      if (vertex->hasRequireds())
+        req = delayAsString(graph_->required(vertex, arrival_index), this);
       bool report_clk_prev = false;
       const char *clk_prev = "";
       if (report_clk_prev
@@ -2726,7 +3013,8 @@ Search::reportArrivals(Vertex *vertex) const
                           arrival_index,
                           rf->asString(),
                           path_ap->pathMinMax()->asString(),
-                          delayAsString(arrivals[arrival_index], this),
+                          delayAsString(graph_->arrival(vertex, arrival_index),
+                                        this),
                           req,
                           tag->asString(true, false, this),
                           clk_prev);
@@ -3056,11 +3344,13 @@ Search::findRequireds(Level level)
 {
   Stats stats(debug_, report_);
   debugPrint(debug_, "search", 1, "find requireds to level %d", level);
+  deferredInvalidFlush();
   RequiredVisitor req_visitor(this);
   if (!requireds_seeded_)
     seedRequireds();
   seedInvalidRequireds();
   int required_count = required_iter_->visitParallel(level, &req_visitor);
+  required_visit_count_ += required_count;
   requireds_exist_ = true;
   debugPrint(debug_, "search", 1, "found %d requireds", required_count);
   stats.report("Find requireds");
@@ -3315,6 +3605,8 @@ RequiredCmp::requiredsSave(Vertex *vertex,
     if (!prev_reqs)
       requireds_changed = true;
     Debug *debug = sta->debug();
+    // Stored requireds may differ from the values set by the resolution.
+    float resolution = sta->graph()->requiredResolution(vertex);
     VertexPathIterator path_iter(vertex, sta);
     while (path_iter.hasNext()) {
       PathVertex *path = path_iter.next();
@@ -3324,7 +3616,9 @@ RequiredCmp::requiredsSave(Vertex *vertex,
       Required req = requireds_[arrival_index];
       if (prev_reqs) {
 	Required prev_req = path->required(sta);
-	if (!delayEqual(prev_req, req)) {
+	if (resolution > 0.0
+	    ? std::abs(delayAsFloat(prev_req - req)) > resolution
+	    : !delayEqual(prev_req, req)) {
 	  debugPrint(debug, "search", 3, "required save %s -> %s",
                      delayAsString(prev_req, sta),
                      delayAsString(req, sta));
@@ -3395,11 +3689,13 @@ RequiredVisitor::visit(Vertex *vertex)
     FindEndRequiredVisitor seeder(required_cmp_, this);
     visit_path_ends_->visitPathEnds(vertex, &seeder);
   }
+  // Stop back propagation when the requireds are unchanged so only
+  // the fanin cone of the changes is visited.
   bool changed = required_cmp_->requiredsSave(vertex, this);
-  search_->tnsInvalid(vertex);
-
-  if (changed)
+  if (changed) {
+    search_->tnsInvalid(vertex);
     search_->requiredIterator()->enqueueAdjacentVertices(vertex);
+  }
 }
 
 bool
@@ -3657,6 +3953,7 @@ void
 Search::tnsInvalid(Vertex *vertex)
 {
   if ((tns_exists_ || worst_slacks_)
+      && !invalid_deferred_
       && isEndpoint(vertex)) {
     debugPrint(debug_, "tns", 2, "tns invalid %s",
                vertex->name(sdc_network_));
@@ -48,6 +48,45 @@ static Pin *
 findDrvrPin(const Pin *pin,
 	    Network *network);
 
+static LogicValue
+logicOr(LogicValue value1,
+	LogicValue value2)
+{
+  static LogicValue logic_or[5][5] =
+    {{LogicValue::zero,   LogicValue::one, LogicValue::unknown, LogicValue::unknown, LogicValue::unknown},
+     {LogicValue::one,    LogicValue::one, LogicValue::one,     LogicValue::one,     LogicValue::one},
+     {LogicValue::unknown,LogicValue::one, LogicValue::unknown, LogicValue::unknown, LogicValue::unknown},
+     {LogicValue::unknown,LogicValue::one, LogicValue::unknown, LogicValue::unknown, LogicValue::unknown},
+     {LogicValue::unknown,LogicValue::one, LogicValue::unknown, LogicValue::unknown, LogicValue::unknown}};
+  return logic_or[int(value1)][int(value2)];
+}
+
+static LogicValue
+logicAnd(LogicValue value1,
+	LogicValue value2)
+{
+  static LogicValue logic_and[5][5] =
+    {{LogicValue::zero,LogicValue::zero,   LogicValue::zero,   LogicValue::zero,    LogicValue::zero},
+     {LogicValue::zero,LogicValue::one,    LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
+     {LogicValue::zero,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
+     {LogicValue::zero,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
+     {LogicValue::zero,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown}};
+  return logic_and[int(value1)][int(value2)];
+}
+
+static LogicValue
+logicXor(LogicValue value1,
+	 LogicValue value2)
+{
+  static LogicValue logic_xor[5][5]=
+    {{LogicValue::zero, LogicValue::one,      LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
+     {LogicValue::one,  LogicValue::zero,     LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
+     {LogicValue::unknown,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
+     {LogicValue::unknown,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
+     {LogicValue::unknown,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown}};
+  return logic_xor[int(value1)][int(value2)];
+}
+
 Sim::Sim(StaState *sta) :
   StaState(sta),
   observer_(nullptr),
@@ -113,22 +152,31 @@ Sim::clearSymtab() const
   symtab_.clear();
 }
 
-LogicValue
-Sim::evalExpr(const FuncExpr *expr,
-	      const Instance *inst) const
+// Return true if no port is referenced more than once in expr.
+static bool
+funcExprReadOnce(const FuncExpr *expr,
+		 LibertyPortSeq &ports)
 {
-  UniqueLock lock(cudd_lock_);
-  DdNode *bdd = funcBdd(expr, inst);
-  LogicValue value = LogicValue::unknown;
-  if (bdd == Cudd_ReadLogicZero(cudd_manager_))
-    value = LogicValue::zero;
-  else if (bdd == Cudd_ReadOne(cudd_manager_))
-    value = LogicValue::one;
-  if (bdd) {
-    Cudd_RecursiveDeref(cudd_manager_, bdd);
-    clearSymtab();
+  switch (expr->op()) {
+  case FuncExpr::op_port: {
+    LibertyPort *port = expr->port();
+    for (LibertyPort *port1 : ports) {
+      if (port1 == port)
+	return false;
+    }
+    ports.push_back(port);
+    return true;
+  }
+  case FuncExpr::op_not:
+    return funcExprReadOnce(expr->left(), ports);
+  case FuncExpr::op_or:
+  case FuncExpr::op_and:
+  case FuncExpr::op_xor:
+    return funcExprReadOnce(expr->left(), ports)
+      && funcExprReadOnce(expr->right(), ports);
+  default:
+    return true;
   }
-  return value;
 }
 
 // Returns nullptr if the expression simply references an internal port.
@@ -226,47 +274,92 @@ Sim::ensureNode(LibertyPort *port) const
   return node;
 }
 
-#else 
-// No CUDD.
-
-static LogicValue
-logicOr(LogicValue value1,
-	LogicValue value2)
+// The three valued evaluation is exact unless the function references
+// a port more than once (A | !A), so the BDD is only built for those.
+LogicValue
+Sim::evalExpr(const FuncExpr *expr,
+	      const Instance *inst) const
 {
-  static LogicValue logic_or[5][5] =
-    {{LogicValue::zero,   LogicValue::one, LogicValue::unknown, LogicValue::unknown, LogicValue::unknown},
-     {LogicValue::one,    LogicValue::one, LogicValue::one,     LogicValue::one,     LogicValue::one},
-     {LogicValue::unknown,LogicValue::one, LogicValue::unknown, LogicValue::unknown, LogicValue::unknown},
-     {LogicValue::unknown,LogicValue::one, LogicValue::unknown, LogicValue::unknown, LogicValue::unknown},
-     {LogicValue::unknown,LogicValue::one, LogicValue::unknown, LogicValue::unknown, LogicValue::unknown}};
-  return logic_or[int(value1)][int(value2)];
+  bool has_pins;
+  LogicValue value = evalExprTernary(expr, inst, has_pins);
+  if (value == LogicValue::unknown
+      && has_pins) {
+    LibertyPortSeq ports;
+    if (!funcExprReadOnce(expr, ports)) {
+      UniqueLock lock(cudd_lock_);
+      DdNode *bdd = funcBdd(expr, inst);
+      if (bdd == Cudd_ReadLogicZero(cudd_manager_))
+	value = LogicValue::zero;
+      else if (bdd == Cudd_ReadOne(cudd_manager_))
+	value = LogicValue::one;
+      if (bdd) {
+	Cudd_RecursiveDeref(cudd_manager_, bdd);
+	clearSymtab();
+      }
+    }
+  }
+  return value;
 }
 
-static LogicValue
-logicAnd(LogicValue value1,
-	LogicValue value2)
+// Three valued evaluation of expr that matches funcBdd.
+// Ports without instance pins are dropped from the function.
+LogicValue
+Sim::evalExprTernary(const FuncExpr *expr,
+		     const Instance *inst,
+		     // Return value.
+		     bool &has_pins) const
 {
-  static LogicValue logic_and[5][5] =
-    {{LogicValue::zero,LogicValue::zero,   LogicValue::zero,   LogicValue::zero,    LogicValue::zero},
-     {LogicValue::zero,LogicValue::one,    LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
-     {LogicValue::zero,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
-     {LogicValue::zero,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
-     {LogicValue::zero,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown}};
-  return logic_and[int(value1)][int(value2)];
+  bool left_pins, right_pins;
+  LogicValue left, right;
+  switch (expr->op()) {
+  case FuncExpr::op_port: {
+    Pin *pin = network_->findPin(inst, expr->port());
+    has_pins = (pin != nullptr);
+    if (pin) {
+      // funcBdd treats rise/fall like unknown.
+      LogicValue value = logicValue(pin);
+      if (logicValueZeroOne(value))
+	return value;
+    }
+    return LogicValue::unknown;
+  }
+  case FuncExpr::op_not:
+    left = evalExprTernary(expr->left(), inst, has_pins);
+    return logicNot(left);
+  case FuncExpr::op_or:
+  case FuncExpr::op_and:
+  case FuncExpr::op_xor:
+    left = evalExprTernary(expr->left(), inst, left_pins);
+    right = evalExprTernary(expr->right(), inst, right_pins);
+    has_pins = left_pins || right_pins;
+    if (left_pins && right_pins) {
+      if (expr->op() == FuncExpr::op_or)
+	return logicOr(left, right);
+      else if (expr->op() == FuncExpr::op_and)
+	return logicAnd(left, right);
+      else
+	return logicXor(left, right);
+    }
+    else if (left_pins)
+      return left;
+    else if (right_pins)
+      return right;
+    else
+      return LogicValue::unknown;
+  case FuncExpr::op_one:
+    has_pins = true;
+    return LogicValue::one;
+  case FuncExpr::op_zero:
+    has_pins = true;
+    return LogicValue::zero;
+  }
+  // Prevent warnings from lame compilers.
+  has_pins = false;
+  return LogicValue::unknown;
 }
 
-static LogicValue
-logicXor(LogicValue value1,
-	 LogicValue value2)
-{
-  static LogicValue logic_xor[5][5]=
-    {{LogicValue::zero, LogicValue::one,      LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
-     {LogicValue::one,  LogicValue::zero,     LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
-     {LogicValue::unknown,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
-     {LogicValue::unknown,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown},
-     {LogicValue::unknown,LogicValue::unknown,LogicValue::unknown,LogicValue::unknown, LogicValue::unknown}};
-  return logic_xor[int(value1)][int(value2)];
-}
+#else 
+// No CUDD.
 
 static TimingSense
 senseNot(TimingSense sense)
@@ -520,6 +613,7 @@ Sim::clear()
   invalid_insts_.clear();
   invalid_drvr_pins_.clear();
   invalid_load_pins_.clear();
+  invalid_constraint_values_.clear();
 }
 
 void
@@ -540,12 +634,14 @@ Sim::ensureConstantsPropagated()
       seedInvalidConstants();
       propagateToInvalidLoads();
       propagateFromInvalidDrvrsToLoads();
+      setConstraintConstPins(&invalid_constraint_values_);
     }
     else {
       clearSimValues();
       seedConstants();
     }
     invalid_insts_.clear();
+    invalid_constraint_values_.clear();
     propagateConstants(false);
     annotateGraphEdges();
     valid_ = true;
@@ -632,6 +728,23 @@ Sim::constantsInvalid()
   incremental_ = false;
 }
 
+// A constant added to a pin without a value only makes more pins
+// constant, so it is propagated from the pin without re-simulating the
+// design. Values that replace a constant invalidate all constants.
+void
+Sim::constraintValueAfter(const Pin *pin,
+			  LogicValue value)
+{
+  if (incremental_
+      && logicValue(pin) == LogicValue::unknown
+      && !invalid_constraint_values_.hasKey(pin)) {
+    invalid_constraint_values_[pin] = value;
+    valid_ = false;
+  }
+  else
+    constantsInvalid();
+}
+
 void
 Sim::ensureConstantFuncPins()
 {
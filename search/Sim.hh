@@ -49,6 +49,9 @@ public:
   void setObserver(SimObserver *observer);
   void ensureConstantsPropagated();
   void constantsInvalid();
+  // set_logic_zero/one/dc or set_case_analysis value added to pin.
+  void constraintValueAfter(const Pin *pin,
+			    LogicValue value);
   LogicValue evalExpr(const FuncExpr *expr,
 		      const Instance *inst) const;
   LogicValue logicValue(const Pin *pin) const;
@@ -124,12 +127,18 @@ protected:
   PinSet invalid_drvr_pins_;
   // Load pins that waiting for the driver constant to propagate.
   PinSet invalid_load_pins_;
+  // Constraint values added since constants were propagated.
+  LogicValueMap invalid_constraint_values_;
   EvalQueue eval_queue_;
   // Instances with constant pin values for annotateVertexEdges.
   InstanceSet instances_with_const_pins_;
   InstanceSet instances_to_annotate_;
 
 #ifdef CUDD
+  LogicValue evalExprTernary(const FuncExpr *expr,
+			     const Instance *inst,
+			     // Return value.
+			     bool &has_pins) const;
   DdNode *funcBdd(const FuncExpr *expr,
 		  const Instance *inst) const;
   DdNode *ensureNode(LibertyPort *port) const;
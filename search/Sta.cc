@@ -16,6 +16,8 @@
 
 #include "Sta.hh"
 
+#include <algorithm>
+
 #include "Machine.hh"
 #include "DispatchQueue.hh"
 #include "ReportTcl.hh"
@@ -31,6 +33,8 @@
 #include "LibertyWriter.hh"
 #include "SdcNetwork.hh"
 #include "MakeConcreteNetwork.hh"
+#include "ConcreteNetwork.hh"
+#include "NetworkSnapshot.hh"
 #include "PortDirection.hh"
 #include "VerilogReader.hh"
 #include "Graph.hh"
@@ -272,7 +276,13 @@ Sta::Sta() :
   graph_sdc_annotated_(false),
   // Default to same parasitics for each corner min/max.
   parasitics_per_corner_(false),
-  parasitics_per_min_max_(false)
+  parasitics_per_min_max_(false),
+  eco_active_(false),
+  eco_drvr_vertices_(new VertexSet(graph_)),
+  eco_load_vertices_(new VertexSet(graph_)),
+  eco_fanin_vertices_(new VertexSet(graph_)),
+  eco_edge_from_vertices_(new VertexSet(graph_)),
+  eco_edge_to_vertices_(new VertexSet(graph_))
 {
 }
 
@@ -541,6 +551,11 @@ Sta::~Sta()
   delete power_;
   delete equiv_cells_;
   delete dispatch_queue_;
+  delete eco_drvr_vertices_;
+  delete eco_load_vertices_;
+  delete eco_fanin_vertices_;
+  delete eco_edge_from_vertices_;
+  delete eco_edge_to_vertices_;
 }
 
 void
@@ -561,6 +576,8 @@ Sta::clear()
     check_min_pulse_widths_->clear();
   if (check_min_periods_)
     check_min_periods_->clear();
+  clearEco();
+  clearSdcPathCache();
   delete graph_;
   graph_ = nullptr;
   current_instance_ = nullptr;
@@ -582,6 +599,8 @@ Sta::networkChanged()
     check_min_pulse_widths_->clear();
   if (check_min_periods_)
     check_min_periods_->clear();
+  clearEco();
+  clearSdcPathCache();
   delete graph_;
   graph_ = nullptr;
   graph_sdc_annotated_ = false;
@@ -747,6 +766,34 @@ Sta::setLinkMakeBlackBoxes(bool make)
   link_make_black_boxes_ = make;
 }
 
+void
+Sta::writeDesignSnapshot(const char *filename)
+{
+  ConcreteNetwork *network = dynamic_cast<ConcreteNetwork*>(network_);
+  if (network)
+    writeNetworkSnapshot(filename, network);
+  else
+    report_->error(810, "network does not support design snapshots.");
+}
+
+bool
+Sta::readDesignSnapshot(const char *filename)
+{
+  ConcreteNetwork *network = dynamic_cast<ConcreteNetwork*>(network_);
+  if (network) {
+    Stats stats(debug_, report_);
+    // Keep the current design until the snapshot is validated.
+    bool status = readNetworkSnapshot(filename, network,
+				      [this] () { readNetlistBefore(); });
+    stats.report("Read snapshot");
+    return status;
+  }
+  else {
+    report_->error(811, "network does not support design snapshots.");
+    return false;
+  }
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -1803,7 +1850,7 @@ Sta::setLogicValue(Pin *pin,
   sdc_->setLogicValue(pin, value);
   // Levelization respects constant disabled edges.
   levelize_->invalid();
-  sim_->constantsInvalid();
+  sim_->constraintValueAfter(pin, value);
   // Constants disable edges which isolate downstream vertices of the
   // graph from the delay calculator's BFS search.  This means that
   // simply invaldating the delays downstream from the constant pin
@@ -1821,7 +1868,7 @@ Sta::setCaseAnalysis(Pin *pin,
   sdc_->setCaseAnalysis(pin, value);
   // Levelization respects constant disabled edges.
   levelize_->invalid();
-  sim_->constantsInvalid();
+  sim_->constraintValueAfter(pin, value);
   // Constants disable edges which isolate downstream vertices of the
   // graph from the delay calculator's BFS search.  This means that
   // simply invaldating the delays downstream from the constant pin
@@ -2115,10 +2162,12 @@ Sta::writeSdc(const char *filename,
 	      bool native,
 	      int digits,
               bool gzip,
-	      bool no_timestamp)
+	      bool no_timestamp,
+	      bool collapse_buses)
 {
   sta::writeSdc(network_->topInstance(), filename, "write_sdc",
-		leaf, native, digits, gzip, no_timestamp, sdc_);
+		leaf, native, digits, gzip, no_timestamp, collapse_buses,
+		sdc_);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -2162,6 +2211,20 @@ Sta::setCrprEnabled(bool enabled)
   sdc_->setCrprEnabled(enabled);
 }
 
+bool
+Sta::pruneExceptionStates() const
+{
+  return search_->pruneExceptionStates();
+}
+
+void
+Sta::setPruneExceptionStates(bool prune)
+{
+  if (prune != search_->pruneExceptionStates())
+    search_->arrivalsInvalid();
+  search_->setPruneExceptionStates(prune);
+}
+
 CrprMode
 Sta::crprMode() const
 {
@@ -2445,7 +2508,10 @@ Sta::findPathEnds(ExceptionFrom *from,
 		  bool clk_gating_setup,
 		  bool clk_gating_hold)
 {
-  searchPreamble();
+  searchPreamble(true);
+  // Reports with the same -from/-through reuse the filtered arrivals.
+  if (!search_->filteredArrivalsReusable(from, thrus, unconstrained))
+    search_->deleteFilteredArrivals();
   return search_->findPathEnds(from, thrus, to, unconstrained,
 			       corner, min_max, group_count, endpoint_count,
 			       unique_pins, slack_min, slack_max,
@@ -2467,11 +2533,19 @@ Sta::findPathEnds(ExceptionFrom *from,
 
 void
 Sta::searchPreamble()
+{
+  searchPreamble(false);
+}
+
+void
+Sta::searchPreamble(bool keep_filtered_arrivals)
 {
   findDelays();
+  search_->deferredInvalidFlush();
   updateGeneratedClks();
   sdc_->searchPreamble();
-  search_->deleteFilteredArrivals();
+  if (!keep_filtered_arrivals)
+    search_->deleteFilteredArrivals();
 }
 
 void
@@ -2792,6 +2866,91 @@ Sta::vertexWorstSlackPath(Vertex *vertex,
   return vertexWorstSlackPath(vertex, nullptr, min_max);
 }
 
+void
+Sta::worstSlackPaths(const PinSeq &pins,
+                     const MinMax *min_max,
+                     // Return values.
+                     PathRefSeq &paths)
+{
+  findRequireds();
+  findPrunedRequireds(pins);
+
+  size_t pin_count = pins.size();
+  paths.resize(pin_count);
+  auto find_worst = [&] (size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      Vertex *vertex, *bidirect_drvr_vertex;
+      graph_->pinVertices(pins[i], vertex, bidirect_drvr_vertex);
+      Slack slack = MinMax::min()->initValue();
+      PathRef worst_path;
+      if (vertex) {
+        worst_path.init(vertexWorstSlackPath(vertex, min_max));
+        if (!worst_path.isNull())
+          slack = worst_path.slack(this);
+      }
+      if (bidirect_drvr_vertex) {
+        PathRef path = vertexWorstSlackPath(bidirect_drvr_vertex, min_max);
+        if (!path.isNull()) {
+          Slack slack1 = path.slack(this);
+          if (delayLess(slack1, slack, this)) {
+            slack = slack1;
+            worst_path.init(path);
+          }
+        }
+      }
+      paths[i].init(worst_path);
+    }
+  };
+  if (thread_count_ == 1)
+    find_worst(0, pin_count);
+  else {
+    size_t chunk_size = (pin_count + thread_count_ - 1) / thread_count_;
+    for (size_t begin = 0; begin < pin_count; begin += chunk_size) {
+      size_t end = std::min(begin + chunk_size, pin_count);
+      dispatch_queue_->dispatch([=, &find_worst] (int) {
+        find_worst(begin, end);
+      });
+    }
+    dispatch_queue_->finishTasks();
+  }
+}
+
+// Find the requireds pruned by crpr at the pin vertices with one
+// arrival/required search instead of one per vertex.
+void
+Sta::findPrunedRequireds(const PinSeq &pins)
+{
+  if (sdc_->crprEnabled()
+      && search_->crprPathPruningEnabled()
+      && !search_->crprApproxMissingRequireds()) {
+    bool pruned = false;
+    Level min_level = 0;
+    int fanout = 0;
+    for (const Pin *pin : pins) {
+      Vertex *vertex, *bidirect_drvr_vertex;
+      graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
+      for (Vertex *vertex1 : {vertex, bidirect_drvr_vertex}) {
+        // See findRequired(vertex) for why clocks are skipped.
+        if (vertex1
+            && vertex1->requiredsPruned()
+            && !search_->isClock(vertex1)) {
+          disableFanoutCrprPruning(vertex1, fanout);
+          min_level = pruned
+            ? std::min(min_level, vertex1->level())
+            : vertex1->level();
+          pruned = true;
+        }
+      }
+    }
+    if (pruned) {
+      debugPrint(debug_, "search", 1, "resurrect pruned requireds fanout %d",
+                 fanout);
+      search_->findArrivals();
+      search_->findRequireds(min_level);
+    }
+  }
+}
+
 Arrival
 Sta::vertexArrival(Vertex *vertex,
                    const MinMax *min_max)
@@ -3285,6 +3444,8 @@ Sta::findDelays(Level level)
 void
 Sta::delayCalcPreamble()
 {
+  // Timing queries commit network edits made since beginEco.
+  commitEco();
   ensureClkNetwork();
 }
 
@@ -3294,6 +3455,24 @@ Sta::setIncrementalDelayTolerance(float tol)
   graph_delay_calc_->setIncrementalDelayTolerance(tol);
 }
 
+void
+Sta::setIncrementalArrivalTolerance(float tol)
+{
+  search_->setArrivalTolerance(tol);
+}
+
+void
+Sta::sdcBatchBegin()
+{
+  search_->deferInvalidBegin();
+}
+
+void
+Sta::sdcBatchEnd()
+{
+  search_->deferInvalidEnd();
+}
+
 ArcDelay
 Sta::arcDelay(Edge *edge,
 	      TimingArc *arc,
@@ -4084,6 +4263,7 @@ Sta::disconnectPin(Pin *pin)
 void
 Sta::makeInstanceAfter(Instance *inst)
 {
+  clearSdcPathCache();
   if (graph_) {
     LibertyCell *lib_cell = network_->libertyCell(inst);
     if (lib_cell) {
@@ -4172,7 +4352,10 @@ Sta::replaceCellPinInvalidate(LibertyPort *from_port,
                && idealClockMode())))
     // Input port capacitance changed, so invalidate delay
     // calculation from input driver.
-    delaysInvalidFromFanin(vertex);
+    if (eco_active_)
+      eco_fanin_vertices_->insert(vertex);
+    else
+      delaysInvalidFromFanin(vertex);
   else
     delaysInvalidFrom(vertex);
 }
@@ -4291,43 +4474,114 @@ Sta::connectPinAfter(Pin *pin)
 void
 Sta::connectDrvrPinAfter(Vertex *vertex)
 {
-  // Invalidate arrival at fanout vertices.
-  VertexOutEdgeIterator edge_iter(vertex, graph_);
-  while (edge_iter.hasNext()) {
-    Edge *edge = edge_iter.next();
-    Vertex *to_vertex = edge->to(graph_);
-    search_->arrivalInvalid(to_vertex);
-    search_->endpointInvalid(to_vertex);
-    sdc_->clkHpinDisablesChanged(to_vertex->pin());
+  if (eco_active_)
+    eco_drvr_vertices_->insert(vertex);
+  else {
+    // Invalidate arrival at fanout vertices.
+    VertexOutEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      Vertex *to_vertex = edge->to(graph_);
+      search_->arrivalInvalid(to_vertex);
+      search_->endpointInvalid(to_vertex);
+      sdc_->clkHpinDisablesChanged(to_vertex->pin());
+    }
+    Pin *pin = vertex->pin();
+    sdc_->clkHpinDisablesChanged(pin);
+    graph_delay_calc_->delayInvalid(vertex);
+    search_->requiredInvalid(vertex);
+    search_->endpointInvalid(vertex);
+    levelize_->invalidFrom(vertex);
+    clk_network_->connectPinAfter(pin);
   }
-  Pin *pin = vertex->pin();
-  sdc_->clkHpinDisablesChanged(pin);
-  graph_delay_calc_->delayInvalid(vertex);
-  search_->requiredInvalid(vertex);
-  search_->endpointInvalid(vertex);
-  levelize_->invalidFrom(vertex);
-  clk_network_->connectPinAfter(pin);
 }
 
 void
 Sta::connectLoadPinAfter(Vertex *vertex)
 {
-  // Invalidate delays and required at fanin vertices.
-  VertexInEdgeIterator edge_iter(vertex, graph_);
-  while (edge_iter.hasNext()) {
-    Edge *edge = edge_iter.next();
-    Vertex *from_vertex = edge->from(graph_);
-    graph_delay_calc_->delayInvalid(from_vertex);
-    search_->requiredInvalid(from_vertex);
-    sdc_->clkHpinDisablesChanged(from_vertex->pin());
+  if (eco_active_)
+    eco_load_vertices_->insert(vertex);
+  else {
+    // Invalidate delays and required at fanin vertices.
+    VertexInEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      Vertex *from_vertex = edge->from(graph_);
+      graph_delay_calc_->delayInvalid(from_vertex);
+      search_->requiredInvalid(from_vertex);
+      sdc_->clkHpinDisablesChanged(from_vertex->pin());
+    }
+    Pin *pin = vertex->pin();
+    sdc_->clkHpinDisablesChanged(pin);
+    graph_delay_calc_->delayInvalid(vertex);
+    levelize_->invalidFrom(vertex);
+    search_->arrivalInvalid(vertex);
+    search_->endpointInvalid(vertex);
+    clk_network_->connectPinAfter(pin);
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
+void
+Sta::beginEco()
+{
+  eco_active_ = true;
+}
+
+// Apply the invalidation recorded since beginEco. Vertices touched
+// by several edits are only visited once.
+void
+Sta::commitEco()
+{
+  if (eco_active_) {
+    eco_active_ = false;
+    if (graph_) {
+      for (Vertex *vertex : *eco_drvr_vertices_)
+	connectDrvrPinAfter(vertex);
+      for (Vertex *vertex : *eco_load_vertices_)
+	connectLoadPinAfter(vertex);
+      for (Vertex *vertex : *eco_fanin_vertices_)
+	delaysInvalidFromFanin(vertex);
+      for (Vertex *vertex : *eco_edge_from_vertices_)
+	deleteEdgeFromInvalid(vertex);
+      for (Vertex *vertex : *eco_edge_to_vertices_)
+	deleteEdgeToInvalid(vertex);
+    }
+    clearEco();
+  }
+}
+
+void
+Sta::clearEco()
+{
+  eco_drvr_vertices_->clear();
+  eco_load_vertices_->clear();
+  eco_fanin_vertices_->clear();
+  eco_edge_from_vertices_->clear();
+  eco_edge_to_vertices_->clear();
+}
+
+// Edits that bypass the sdc network still change the instances
+// that sdc path names resolve to.
+void
+Sta::clearSdcPathCache()
+{
+  SdcNetwork *sdc_network = dynamic_cast<SdcNetwork*>(sdc_network_);
+  if (sdc_network)
+    sdc_network->clearPathCache();
+}
+
+void
+Sta::ecoDeleteVertexBefore(Vertex *vertex)
+{
+  if (eco_active_) {
+    eco_drvr_vertices_->erase(vertex);
+    eco_load_vertices_->erase(vertex);
+    eco_fanin_vertices_->erase(vertex);
+    eco_edge_from_vertices_->erase(vertex);
+    eco_edge_to_vertices_->erase(vertex);
   }
-  Pin *pin = vertex->pin();
-  sdc_->clkHpinDisablesChanged(pin);
-  graph_delay_calc_->delayInvalid(vertex);
-  levelize_->invalidFrom(vertex);
-  search_->arrivalInvalid(vertex);
-  search_->endpointInvalid(vertex);
-  clk_network_->connectPinAfter(pin);
 }
 
 void
@@ -4382,15 +4636,33 @@ Sta::deleteEdge(Edge *edge)
 {
   Vertex *from = edge->from(graph_);
   Vertex *to = edge->to(graph_);
-  search_->arrivalInvalid(to);
-  search_->requiredInvalid(from);
-  graph_delay_calc_->delayInvalid(to);
+  if (eco_active_) {
+    eco_edge_from_vertices_->insert(from);
+    eco_edge_to_vertices_->insert(to);
+  }
+  else {
+    deleteEdgeFromInvalid(from);
+    deleteEdgeToInvalid(to);
+  }
   levelize_->relevelizeFrom(to);
   levelize_->deleteEdgeBefore(edge);
-  sdc_->clkHpinDisablesChanged(edge->from(graph_)->pin());
   graph_->deleteEdge(edge);
 }
 
+void
+Sta::deleteEdgeFromInvalid(Vertex *from)
+{
+  search_->requiredInvalid(from);
+  sdc_->clkHpinDisablesChanged(from->pin());
+}
+
+void
+Sta::deleteEdgeToInvalid(Vertex *to)
+{
+  search_->arrivalInvalid(to);
+  graph_delay_calc_->delayInvalid(to);
+}
+
 void
 Sta::deleteNetBefore(Net *net)
 {
@@ -4414,12 +4686,14 @@ Sta::deleteNetBefore(Net *net)
     }
     delete pin_iter;
   }
+  parasitics_->deleteParasiticNetworks(net);
   sdc_->deleteNetBefore(net);
 }
 
 void
 Sta::deleteInstanceBefore(Instance *inst)
 {
+  clearSdcPathCache();
   if (network_->isLeaf(inst)) {
     deleteInstancePinsBefore(inst);
     deleteLeafInstanceBefore(inst);
@@ -4462,6 +4736,7 @@ Sta::deletePinBefore(Pin *pin)
         levelize_->deleteVertexBefore(vertex);
         graph_delay_calc_->deleteVertexBefore(vertex);
         search_->deleteVertexBefore(vertex);
+        ecoDeleteVertexBefore(vertex);
 
         VertexInEdgeIterator in_edge_iter(vertex, graph_);
         while (in_edge_iter.hasNext()) {
@@ -4482,6 +4757,7 @@ Sta::deletePinBefore(Pin *pin)
         levelize_->deleteVertexBefore(vertex);
         graph_delay_calc_->deleteVertexBefore(vertex);
         search_->deleteVertexBefore(vertex);
+        ecoDeleteVertexBefore(vertex);
 
         VertexOutEdgeIterator edge_iter(vertex, graph_);
         while (edge_iter.hasNext()) {
@@ -4506,10 +4782,15 @@ Sta::deletePinBefore(Pin *pin)
         levelize_->deleteVertexBefore(vertex);
         graph_delay_calc_->deleteVertexBefore(vertex);
         search_->deleteVertexBefore(vertex);
+        ecoDeleteVertexBefore(vertex);
         graph_->deleteVertex(vertex);
       }
     }
   }
+  // Parasitics are indexed by pin id, so delete them with the pin.
+  if (network_->isDriver(pin)
+      && parasitics_->haveParasitics())
+    parasitics_->deleteDrvrReducedParasitics(pin);
   sim_->deletePinBefore(pin);
   clk_network_->deletePinBefore(pin);
 }
@@ -276,9 +276,10 @@ TagGroupBldr::makeArrivalMap(const StaState *sta)
 
 void
 TagGroupBldr::copyArrivals(TagGroup *tag_group,
-			   Arrival *arrivals,
+			   Vertex *vertex,
 			   PathVertexRep *prev_paths)
 {
+  group_arrivals_.resize(tag_group->arrivalCount());
   ArrivalMap::Iterator arrival_iter1(arrival_map_);
   while (arrival_iter1.hasNext()) {
     Tag *tag1;
@@ -287,7 +288,7 @@ TagGroupBldr::copyArrivals(TagGroup *tag_group,
     bool exists2;
     tag_group->arrivalIndex(tag1, arrival_index2, exists2);
     if (exists2) {
-      arrivals[arrival_index2] = arrivals_[arrival_index1];
+      group_arrivals_[arrival_index2] = arrivals_[arrival_index1];
       if (prev_paths) {
 	PathVertexRep *prev_path = &prev_paths_[arrival_index1];
 	prev_paths[arrival_index2].init(prev_path);
@@ -296,6 +297,8 @@ TagGroupBldr::copyArrivals(TagGroup *tag_group,
     else
       sta_->report()->critical(265, "tag group missing tag");
   }
+  sta_->graph()->setArrivals(vertex, group_arrivals_.data(),
+			     group_arrivals_.size());
 }
 
 ////////////////////////////////////////////////////////////////
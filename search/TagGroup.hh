@@ -118,8 +118,9 @@ public:
 		       int arrival_index,
 		       PathVertexRep *prev_path);
   ArrivalMap *arrivalMap() { return &arrival_map_; }
+  // Copy arrivals to vertex in tag_group arrival index order.
   void copyArrivals(TagGroup *tag_group,
-		    Arrival *arrivals,
+		    Vertex *vertex,
 		    PathVertexRep *prev_paths);
 
 protected:
@@ -131,6 +132,8 @@ protected:
   ArrivalMap arrival_map_;
   ArrivalSeq arrivals_;
   PathVertexRepSeq prev_paths_;
+  // Arrivals in tag group arrival index order for copyArrivals.
+  ArrivalSeq group_arrivals_;
   bool has_clk_tag_;
   bool has_genclk_src_tag_:1;
   bool has_filter_tag_;
@@ -26,8 +26,6 @@
 
 namespace sta {
 
-using std::min;
-
 WorstSlacks::WorstSlacks(StaState *sta) :
   worst_slacks_(sta->corners()->pathAnalysisPtCount(), sta),
   sta_(sta)
@@ -91,29 +89,21 @@ WorstSlacks::worstSlackNotifyBefore(Vertex *vertex)
 WorstSlack::WorstSlack(StaState *sta) :
   StaState(sta),
   slack_init_(MinMax::min()->initValue()),
-  worst_vertex_(nullptr),
-  worst_slack_(slack_init_),
-  slack_threshold_(slack_init_),
-  queue_(new VertexSet(graph_)),
-  min_queue_size_(10),
-  max_queue_size_(20)
+  slacks_exist_(false),
+  sorted_slacks_(new VertexSlackSet(VertexSlackLess(this)))
 {
 }
 
 WorstSlack::~WorstSlack()
 {
-  delete queue_;
+  delete sorted_slacks_;
 }
 
 WorstSlack::WorstSlack(const WorstSlack &worst_slack) :
   StaState(worst_slack),
   slack_init_(MinMax::min()->initValue()),
-  worst_vertex_(nullptr),
-  worst_slack_(slack_init_),
-  slack_threshold_(slack_init_),
-  queue_(new VertexSet(graph_)),
-  min_queue_size_(10),
-  max_queue_size_(20)
+  slacks_exist_(false),
+  sorted_slacks_(new VertexSlackSet(VertexSlackLess(this)))
 {
 }
 
@@ -121,11 +111,7 @@ void
 WorstSlack::deleteVertexBefore(Vertex *vertex)
 {
   UniqueLock lock(lock_);
-  if (vertex == worst_vertex_) {
-    worst_vertex_ = nullptr;
-    worst_slack_ = slack_init_;
-  }
-  queue_->erase(vertex);
+  eraseSlack(vertex);
 }
 
 void
@@ -134,130 +120,31 @@ WorstSlack::worstSlack(PathAPIndex path_ap_index,
 		       Slack &worst_slack,
 		       Vertex *&worst_vertex)
 {
-  findWorstSlack(path_ap_index);
-  worst_slack = worst_slack_;
-  worst_vertex = worst_vertex_;
-}
-
-void
-WorstSlack::findWorstSlack(PathAPIndex path_ap_index)
-{
-  if (worst_vertex_ == nullptr) {
-    if (queue_->empty())
-      initQueue(path_ap_index);
-    else
-      findWorstInQueue(path_ap_index);
-  }
-}
-
-void
-WorstSlack::initQueue(PathAPIndex path_ap_index)
-{
-  debugPrint(debug_, "wns", 3, "init queue");
-
-  queue_->clear();
-  worst_vertex_ = nullptr;
-  worst_slack_ = slack_init_;
-  slack_threshold_ = slack_init_;
-  for(Vertex *vertex : *search_->endpoints()) {
-    Slack slack = search_->wnsSlack(vertex, path_ap_index);
-    if (!delayEqual(slack, slack_init_)) {
-      if (delayLess(slack, worst_slack_, this))
-	setWorstSlack(vertex, slack);
-      if (delayLessEqual(slack, slack_threshold_, this))
-	queue_->insert(vertex);
-      int queue_size = queue_->size();
-      if (queue_size >= max_queue_size_)
-	sortQueue(path_ap_index);
-    }
+  if (!slacks_exist_)
+    findEndpointSlacks(path_ap_index);
+  if (sorted_slacks_->empty()) {
+    worst_slack = slack_init_;
+    worst_vertex = nullptr;
   }
-  debugPrint(debug_, "wns", 3, "threshold %s",
-             delayAsString(slack_threshold_, this));
-//  checkQueue();
-}
-
-void
-WorstSlack::sortQueue(PathAPIndex path_ap_index)
-{
-  if (queue_->size() > 0) {
-    debugPrint(debug_, "wns", 3, "sort queue");
-
-    VertexSeq vertices;
-    vertices.reserve(queue_->size());
-    for (Vertex *vertex : *queue_)
-      vertices.push_back(vertex);
-    WnsSlackLess slack_less(path_ap_index, this);
-    sort(vertices, slack_less);
-
-    int vertex_count = vertices.size();
-    int threshold_index = min(min_queue_size_, vertex_count - 1);
-    Vertex *threshold_vertex = vertices[threshold_index];
-    slack_threshold_ = search_->wnsSlack(threshold_vertex, path_ap_index);
-    debugPrint(debug_, "wns", 3, "threshold %s",
-               delayAsString(slack_threshold_, this));
-
-    // Reinsert vertices with slack < threshold.
-    queue_->clear();
-    VertexSeq::Iterator queue_iter2(vertices);
-    while (queue_iter2.hasNext()) {
-      Vertex *vertex = queue_iter2.next();
-      Slack slack = search_->wnsSlack(vertex, path_ap_index);
-      if (delayGreater(slack, slack_threshold_, this))
-	break;
-      queue_->insert(vertex);
-    }
-    max_queue_size_ = queue_->size() * 2;
-    Vertex *worst_slack_vertex = vertices[0];
-    Slack worst_slack_slack = search_->wnsSlack(worst_slack_vertex, path_ap_index);
-    setWorstSlack(worst_slack_vertex, worst_slack_slack);
+  else {
+    const VertexSlack &worst = *sorted_slacks_->begin();
+    worst_slack = worst.first;
+    worst_vertex = worst.second;
   }
 }
 
 void
-WorstSlack::findWorstInQueue(PathAPIndex path_ap_index)
+WorstSlack::findEndpointSlacks(PathAPIndex path_ap_index)
 {
-  debugPrint(debug_, "wns", 3, "find worst in queue");
-
-  worst_vertex_ = nullptr;
-  worst_slack_ = slack_init_;
-  for (Vertex *vertex : *queue_) {
+  debugPrint(debug_, "wns", 3, "find endpoint slacks");
+  sorted_slacks_->clear();
+  slacks_.clear();
+  for (Vertex *vertex : *search_->endpoints()) {
     Slack slack = search_->wnsSlack(vertex, path_ap_index);
-    if (delayLess(slack, worst_slack_, this))
-      setWorstSlack(vertex, slack);
-  }
-}
-
-void
-WorstSlack::checkQueue(PathAPIndex path_ap_index)
-{
-  VertexSeq ends;
-  for(Vertex *end : *search_->endpoints()) {
-    if (delayLessEqual(search_->wnsSlack(end, path_ap_index),
-		       slack_threshold_, this))
-      ends.push_back(end);
-  }
-  WnsSlackLess slack_less(path_ap_index, this);
-  sort(ends, slack_less);
-
-  VertexSet end_set(graph_);
-  for (Vertex *end : ends) {
-    end_set.insert(end);
-    if (!queue_->hasKey(end)
-	&& delayLessEqual(search_->wnsSlack(end, path_ap_index),
-			  slack_threshold_, this))
-      report_->reportLine("WorstSlack queue missing %s %s < %s",
-                          end->name(network_),
-                          delayAsString(search_->wnsSlack(end, path_ap_index), this),
-                          delayAsString(slack_threshold_, this));
-  }
-
-  for (Vertex *end : *queue_) {
-    if (!end_set.hasKey(end))
-      report_->reportLine("WorstSlack queue extra %s %s > %s",
-                          end->name(network_),
-                          delayAsString(search_->wnsSlack(end, path_ap_index), this),
-                          delayAsString(slack_threshold_, this));
+    if (!delayEqual(slack, slack_init_))
+      setSlack(vertex, slack);
   }
+  slacks_exist_ = true;
 }
 
 void
@@ -266,60 +153,62 @@ WorstSlack::updateWorstSlack(Vertex *vertex,
 			     PathAPIndex path_ap_index)
 {
   Slack slack = slacks[path_ap_index];
-
   // Locking is required because ArrivalVisitor is called by multiple
   // threads.
   UniqueLock lock(lock_);
-  if (worst_vertex_
-      && delayLess(slack, worst_slack_, this))
-    setWorstSlack(vertex, slack);
-  else if (vertex == worst_vertex_)
-    // Mark worst slack as unknown (updated by findWorstSlack().
-    worst_vertex_ = nullptr;
-
-  if (!delayEqual(slack, slack_init_)
-      && delayLessEqual(slack, slack_threshold_, this)) {
-    debugPrint(debug_, "wns", 3, "insert %s %s",
-               vertex->name(network_),
-               delayAsString(slack, this));
-    queue_->insert(vertex);
-  }
-  else {
-    debugPrint(debug_, "wns", 3, "delete %s %s",
-               vertex->name(network_),
-               delayAsString(slack, this));
-    queue_->erase(vertex);
+  if (slacks_exist_) {
+    eraseSlack(vertex);
+    if (!delayEqual(slack, slack_init_)) {
+      debugPrint(debug_, "wns", 3, "update %s %s",
+                 vertex->name(network_),
+                 delayAsString(slack, this));
+      setSlack(vertex, slack);
+    }
   }
-  //  checkQueue();
 }
 
 void
-WorstSlack::setWorstSlack(Vertex *vertex,
-			  Slack slack)
+WorstSlack::setSlack(Vertex *vertex,
+		     Slack slack)
 {
-  debugPrint(debug_, "wns", 3, "%s %s",
-             vertex->name(network_),
-             delayAsString(slack, this));
-  worst_vertex_ = vertex;
-  worst_slack_ = slack;
+  slacks_[vertex] = slack;
+  sorted_slacks_->insert(VertexSlack(slack, vertex));
+}
+
+void
+WorstSlack::eraseSlack(Vertex *vertex)
+{
+  Slack slack;
+  bool exists;
+  slacks_.findKey(vertex, slack, exists);
+  if (exists) {
+    sorted_slacks_->erase(VertexSlack(slack, vertex));
+    slacks_.erase(vertex);
+  }
 }
 
 ////////////////////////////////////////////////////////////////
 
-WnsSlackLess::WnsSlackLess(PathAPIndex path_ap_index,
-			   const StaState *sta) :
-  path_ap_index_(path_ap_index),
-  search_(sta->search())
+VertexSlackLess::VertexSlackLess(const StaState *sta) :
+  sta_(sta)
 {
 }
 
 bool
-WnsSlackLess::operator()(Vertex *vertex1,
-			 Vertex *vertex2)
-{
-  return delayLess(search_->wnsSlack(vertex1, path_ap_index_),
-		   search_->wnsSlack(vertex2, path_ap_index_),
-		   search_);
+VertexSlackLess::operator()(const VertexSlack &vertex_slack1,
+			    const VertexSlack &vertex_slack2) const
+{
+  // Exact comparison; fuzzy delayLess is not a strict weak ordering.
+  float slack1 = delayAsFloat(vertex_slack1.first);
+  float slack2 = delayAsFloat(vertex_slack2.first);
+  if (slack1 < slack2)
+    return true;
+  else if (slack1 > slack2)
+    return false;
+  else {
+    const Graph *graph = sta_->graph();
+    return graph->id(vertex_slack1.second) < graph->id(vertex_slack2.second);
+  }
 }
 
 } // namespace
@@ -17,9 +17,12 @@
 #pragma once
 
 #include <mutex>
+#include <utility>
 
 #include "MinMax.hh"
 #include "Vector.hh"
+#include "Map.hh"
+#include "Set.hh"
 #include "GraphClass.hh"
 #include "SearchClass.hh"
 #include "StaState.hh"
@@ -28,9 +31,11 @@ namespace sta {
 
 class StaState;
 class WorstSlack;
-class WnsSlackLess;
+class VertexSlackLess;
 
 typedef Vector<WorstSlack> WorstSlackSeq;
+typedef std::pair<Slack, Vertex*> VertexSlack;
+typedef Set<VertexSlack, VertexSlackLess> VertexSlackSet;
 
 class WorstSlacks
 {
@@ -54,19 +59,22 @@ protected:
   const StaState *sta_;
 };
 
-class WnsSlackLess
+// Order by slack and then vertex id so no two entries are equal.
+class VertexSlackLess
 {
 public:
-  WnsSlackLess(PathAPIndex path_ap_index,
-	       const StaState *sta);
-  bool operator()(Vertex *vertex1,
-		  Vertex *vertex2);
+  VertexSlackLess(const StaState *sta);
+  bool operator()(const VertexSlack &vertex_slack1,
+		  const VertexSlack &vertex_slack2) const;
 
 private:
-  PathAPIndex path_ap_index_;
-  Search *search_;
+  const StaState *sta_;
 };
 
+// Endpoint slacks for one path analysis point sorted by slack.
+// The endpoints are scanned once on the first request. After that
+// updateWorstSlack keeps the slacks sorted as endpoints change, so the
+// worst slack is found without rescanning the endpoints.
 class WorstSlack : public StaState
 {
 public:
@@ -83,26 +91,17 @@ public:
   void deleteVertexBefore(Vertex *vertex);
 
 protected:
-  void findWorstSlack(PathAPIndex path_ap_index);
-  void initQueue(PathAPIndex path_ap_index);
-  void findWorstInQueue(PathAPIndex path_ap_index);
-  void setWorstSlack(Vertex *vertex,
-		     Slack slack);
-  void sortQueue(PathAPIndex path_ap_index);
-  void checkQueue(PathAPIndex path_ap_index);
+  void findEndpointSlacks(PathAPIndex path_ap_index);
+  void setSlack(Vertex *vertex,
+		Slack slack);
+  void eraseSlack(Vertex *vertex);
 
   Slack slack_init_;
-  // Vertex with the worst slack.
-  // When nullptr the worst slack is unknown but in the queue.
-  Vertex *worst_vertex_;
-  Slack worst_slack_;
-  Slack slack_threshold_;
-  // Vertices with slack < threshold_
-  VertexSet *queue_;
-  // Queue is sorted and pruned to min_queue_size_ vertices when it
-  // reaches max_queue_size_.
-  int min_queue_size_;
-  int max_queue_size_;
+  bool slacks_exist_;
+  // Endpoints with slacks sorted by slack.
+  VertexSlackSet *sorted_slacks_;
+  // Endpoint -> slack in sorted_slacks_.
+  Map<Vertex*, Slack> slacks_;
   std::mutex lock_;
 };
 
@@ -40,5 +40,19 @@ proc_redirect link_design {
   link_design_cmd $top_cell_name
 }
 
+define_cmd_args "write_design_snapshot" {filename}
+
+proc write_design_snapshot { args } {
+  check_argc_eq1 "write_design_snapshot" $args
+  write_design_snapshot_cmd [file nativename [lindex $args 0]]
+}
+
+define_cmd_args "read_design_snapshot" {filename}
+
+proc_redirect read_design_snapshot {
+  check_argc_eq1 "read_design_snapshot" $args
+  read_design_snapshot_cmd [file nativename [lindex $args 0]]
+}
+
 # sta namespace end
 }
@@ -93,6 +93,18 @@ disconnect_pin_cmd(Pin *pin)
   Sta::sta()->disconnectPin(pin);
 }
 
+void
+begin_eco_cmd()
+{
+  Sta::sta()->beginEco();
+}
+
+void
+commit_eco_cmd()
+{
+  Sta::sta()->commitEco();
+}
+
 // Notify STA of network change.
 void
 network_changed()
@@ -236,6 +236,18 @@ proc replace_cell { instance lib_cell } {
   }
 }
 
+################################################################
+
+# Network edits between begin_eco and commit_eco invalidate timing
+# once per changed pin when commit_eco is called or timing is queried.
+proc begin_eco {} {
+  begin_eco_cmd
+}
+
+proc commit_eco {} {
+  commit_eco_cmd
+}
+
 proc path_regexp {} {
   global hierarchy_separator
   set id_regexp "\[^${hierarchy_separator}\]+"
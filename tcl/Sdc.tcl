@@ -34,7 +34,13 @@ proc_redirect read_sdc {
   check_argc_eq1 "read_sdc" $args
   set echo [info exists flags(-echo)]
   set filename [file nativename [lindex $args 0]]
-  source_ $filename $echo 0
+  # Invalidate the search once for the whole file.
+  sdc_batch_begin
+  set code [catch {source_ $filename $echo 0} result options]
+  sdc_batch_end
+  if { $code } {
+    return -options $options $result
+  }
 }
 
 ################################################################
@@ -141,11 +147,12 @@ proc source_ { filename echo verbose } {
 ################################################################
 
 define_cmd_args "write_sdc" \
-  {[-map_hpins] [-digits digits] [-gzip] [-no_timestamp] filename}
+  {[-map_hpins] [-digits digits] [-gzip] [-no_timestamp] [-collapse_buses]\
+     filename}
 
 proc write_sdc { args } {
   parse_key_args "write_sdc" args keys {-digits -significant_digits} \
-    flags {-map_hpins -compatible -gzip -no_timestamp}
+    flags {-map_hpins -compatible -gzip -no_timestamp -collapse_buses}
   check_argc_eq1 "write_sdc" $args
 
   set digits 4
@@ -159,7 +166,9 @@ proc write_sdc { args } {
   set no_timestamp [info exists flags(-no_timestamp)]
   set map_hpins [info exists flags(-map_hpins)]
   set native [expr ![info exists flags(-compatible)]]
-  write_sdc_cmd $filename $map_hpins $native $digits $gzip $no_timestamp
+  set collapse_buses [info exists flags(-collapse_buses)]
+  write_sdc_cmd $filename $map_hpins $native $digits $gzip $no_timestamp \
+    $collapse_buses
 }
 
 ################################################################
@@ -539,7 +548,20 @@ proc get_cells { args } {
     if { $args == {} } {
       set insts [network_leaf_instances]
     } else {
-      foreach pattern $patterns {
+      # Resolve plain instance names in one pass.
+      set name_insts {}
+      if { !$hierarchical && !$regexp && !$nocase \
+	     && $divider == $hierarchy_separator } {
+	set name_insts [find_instances_names $patterns]
+      }
+      if { $name_insts == {} } {
+	set name_insts [lrepeat [llength $patterns] "NULL"]
+      }
+      foreach pattern $patterns name_inst $name_insts {
+	if { $name_inst != "NULL" } {
+	  lappend insts $name_inst
+	  continue
+	}
 	if { $divider != $hierarchy_separator } {
 	  regsub $divider $pattern $hierarchy_separator pattern
 	}
@@ -928,7 +950,19 @@ proc get_pins { args } {
     }
     # Copy backslashes that will be removed by foreach.
     set patterns [string map {\\ \\\\} $patterns]
-    foreach pattern $patterns {
+    # Resolve plain pin names in one pass.
+    set name_pins {}
+    if { !$hierarchical && !$regexp && !$nocase } {
+      set name_pins [find_pins_names $patterns]
+    }
+    if { $name_pins == {} } {
+      set name_pins [lrepeat [llength $patterns] "NULL"]
+    }
+    foreach pattern $patterns name_pin $name_pins {
+      if { $name_pin != "NULL" } {
+	lappend pins $name_pin
+	continue
+      }
       if { $hierarchical } {
 	set matches [find_pins_hier_matching $pattern $regexp $nocase]
       } else {
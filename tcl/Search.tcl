@@ -1014,6 +1014,29 @@ proc worst_slack1 { cmd args1 } {
 
 ################################################################
 
+define_cmd_args "find_worst_slack_paths" {[-min]|[-max] pins}
+
+# Return a list of {pin slack path} with the worst slack path through
+# each pin. Pins without paths have a NULL path.
+proc find_worst_slack_paths { args } {
+  parse_key_args "find_worst_slack_paths" args keys {} flags {-min -max}
+  check_argc_eq1 "find_worst_slack_paths" $args
+  set min_max [parse_min_max_flags flags]
+  set pins [get_port_pins_error "pins" [lindex $args 0]]
+  set paths [worst_slack_paths_cmd $pins $min_max]
+  set pin_paths {}
+  foreach pin $pins path $paths {
+    if { $path == "NULL" } {
+      lappend pin_paths [list $pin "INF" $path]
+    } else {
+      lappend pin_paths [list $pin [time_sta_ui [$path slack]] $path]
+    }
+  }
+  return $pin_paths
+}
+
+################################################################
+
 define_hidden_cmd_args "worst_clock_skew" {[-setup]|[-hold]}
 
 proc worst_clock_skew { args } {
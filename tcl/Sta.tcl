@@ -606,6 +606,10 @@ proc unset_timing_derate { args } {
 #  
 ################################################################
 
+define_cmd_args "begin_eco" {}
+
+define_cmd_args "commit_eco" {}
+
 define_cmd_args "connect_pin" {net pin}
 # deprecated 2.0.16 05/02/2019
 define_cmd_args "connect_pins" {net pins}
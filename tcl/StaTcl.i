@@ -55,6 +55,7 @@
 #include "Wireload.hh"
 #include "PortDirection.hh"
 #include "Network.hh"
+#include "SdcNetwork.hh"
 #include "Clock.hh"
 #include "PortDelay.hh"
 #include "ExceptionPath.hh"
@@ -76,6 +77,7 @@
 #include "Sta.hh"
 #include "search/Tag.hh"
 #include "search/CheckTiming.hh"
+#include "search/Crpr.hh"
 #include "search/CheckMinPulseWidths.hh"
 #include "search/Levelize.hh"
 #include "search/ReportPath.hh"
@@ -101,6 +103,7 @@ typedef InstanceSeq TmpInstanceSeq;
 typedef InstanceSet TmpInstanceSet;
 typedef MinPulseWidthCheckSeq::Iterator MinPulseWidthCheckSeqIterator;
 typedef FloatSeq TmpFloatSeq;
+typedef PathRefSeq TmpPathRefSeq;
 typedef string TmpString;
 typedef Set<const char*, CharPtrLess> StringSet;
 typedef MinMaxAll MinMaxAllNull;
@@ -1318,6 +1321,26 @@ using namespace sta;
   Tcl_SetObjResult(interp, list);
 }
 
+// Null paths are returned as NULL.
+%typemap(out) TmpPathRefSeq* {
+  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
+  PathRefSeq *paths = $1;
+  PathRefSeq::Iterator path_iter(paths);
+  while (path_iter.hasNext()) {
+    PathRef *path = &path_iter.next();
+    Tcl_Obj *obj;
+    if (path->isNull())
+      obj = Tcl_NewStringObj("NULL", -1);
+    else {
+      PathRef *copy = new PathRef(path);
+      obj = SWIG_NewInstanceObj(copy, SWIGTYPE_p_PathRef, false);
+    }
+    Tcl_ListObjAppendElement(interp, list, obj);
+  }
+  delete paths;
+  Tcl_SetObjResult(interp, list);
+}
+
 %typemap(out) MinPulseWidthCheck* {
   Tcl_Obj *obj = SWIG_NewInstanceObj($1, $1_descriptor, false);
   Tcl_SetObjResult(interp, obj);
@@ -2299,6 +2322,19 @@ set_link_make_black_boxes(bool make)
   Sta::sta()->setLinkMakeBlackBoxes(make);
 }
 
+void
+write_design_snapshot_cmd(const char *filename)
+{
+  cmdLinkedNetwork();
+  Sta::sta()->writeDesignSnapshot(filename);
+}
+
+bool
+read_design_snapshot_cmd(const char *filename)
+{
+  return Sta::sta()->readDesignSnapshot(filename);
+}
+
 Instance *
 top_instance()
 {
@@ -2408,6 +2444,23 @@ find_pins_matching(const char *pattern,
   return pins;
 }
 
+// Pins for a list of path names resolved in one pass, with NULL for
+// names that find_pins_matching has to match. Empty if the names
+// cannot be resolved in one pass.
+TmpPinSeq *
+find_pins_names(StringSeq *names)
+{
+  Sta *sta = Sta::sta();
+  SdcNetwork *network = dynamic_cast<SdcNetwork*>(cmdLinkedNetwork());
+  TmpPinSeq *pins = new TmpPinSeq;
+  if (network
+      && sta->currentInstance() == network->topInstance()
+      && !network->findPins(*names, *pins))
+    pins->clear();
+  delete names;
+  return pins;
+}
+
 TmpPinSeq *
 find_pins_hier_matching(const char *pattern,
 			bool regexp,
@@ -2454,6 +2507,21 @@ find_instances_matching(const char *pattern,
   return insts;
 }
 
+// Instances for a list of path names like find_pins_names.
+TmpInstanceSeq *
+find_instances_names(StringSeq *names)
+{
+  Sta *sta = Sta::sta();
+  SdcNetwork *network = dynamic_cast<SdcNetwork*>(cmdLinkedNetwork());
+  TmpInstanceSeq *insts = new InstanceSeq;
+  if (network
+      && sta->currentInstance() == network->topInstance()
+      && !network->findInstances(*names, *insts))
+    insts->clear();
+  delete names;
+  return insts;
+}
+
 TmpInstanceSeq *
 find_instances_hier_matching(const char *pattern,
 			     bool regexp,
@@ -4143,6 +4211,36 @@ set_crpr_enabled(bool enabled)
   return Sta::sta()->setCrprEnabled(enabled);
 }
 
+bool
+prune_exception_states()
+{
+  return Sta::sta()->pruneExceptionStates();
+}
+
+void
+set_prune_exception_states(bool prune)
+{
+  Sta::sta()->setPruneExceptionStates(prune);
+}
+
+int
+pruned_exception_state_count()
+{
+  return Sta::sta()->search()->prunedExceptionStateCount();
+}
+
+void
+set_crpr_clk_tree_indexed(bool indexed)
+{
+  Sta::sta()->search()->checkCrpr()->setClkTreeIndexed(indexed);
+}
+
+int
+crpr_clk_tree_path_count()
+{
+  return Sta::sta()->search()->checkCrpr()->clkTreePathCount();
+}
+
 const char *
 crpr_mode()
 {
@@ -4726,6 +4824,18 @@ vertex_worst_slack_path(Vertex *vertex,
     return nullptr;
 }
 
+TmpPathRefSeq *
+worst_slack_paths_cmd(PinSeq *pins,
+		      const MinMax *min_max)
+{
+  cmdLinkedNetwork();
+  Sta *sta = Sta::sta();
+  PathRefSeq *paths = new PathRefSeq;
+  sta->worstSlackPaths(*pins, min_max, *paths);
+  delete pins;
+  return paths;
+}
+
 Slack
 find_clk_min_period(const Clock *clk,
                     bool ignore_port_paths)
@@ -5022,10 +5132,12 @@ write_sdc_cmd(const char *filename,
 	      bool compatible,
 	      int digits,
               bool gzip,
-	      bool no_timestamp)
+	      bool no_timestamp,
+	      bool collapse_buses)
 {
   cmdLinkedNetwork();
-  Sta::sta()->writeSdc(filename, leaf, compatible, digits, gzip, no_timestamp);
+  Sta::sta()->writeSdc(filename, leaf, compatible, digits, gzip, no_timestamp,
+		       collapse_buses);
 }
 
 void
@@ -5393,6 +5505,42 @@ report_arrival_count_histogram()
   Sta::sta()->search()->reportArrivalCountHistogram();
 }
 
+void
+set_arrival_incremental_tolerance(float tol)
+{
+  Sta::sta()->setIncrementalArrivalTolerance(tol);
+}
+
+void
+sdc_batch_begin()
+{
+  Sta::sta()->sdcBatchBegin();
+}
+
+void
+sdc_batch_end()
+{
+  Sta::sta()->sdcBatchEnd();
+}
+
+int
+arrival_visit_count()
+{
+  return Sta::sta()->search()->arrivalVisitCount();
+}
+
+int
+required_visit_count()
+{
+  return Sta::sta()->search()->requiredVisitCount();
+}
+
+void
+clear_search_visit_counts()
+{
+  Sta::sta()->search()->clearVisitCounts();
+}
+
 int
 tag_count()
 {
@@ -6025,6 +6173,7 @@ void finish() { delete self; }
 
 %extend Vertex {
 Pin *pin() { return self->pin(); }
+int id() { return Sta::sta()->graph()->id(self); }
 bool is_bidirect_driver() { return self->isBidirectDriver(); }
 int level() { return Sta::sta()->vertexLevel(self); }
 int tag_group_index() { return self->tagGroupIndex(); }
@@ -6215,6 +6364,7 @@ Vertex *from() { return self->from(Sta::sta()->graph()); }
 Vertex *to() { return self->to(Sta::sta()->graph()); }
 Pin *from_pin() { return self->from(Sta::sta()->graph())->pin(); }
 Pin *to_pin() { return self->to(Sta::sta()->graph())->pin(); }
+int id() { return Sta::sta()->graph()->id(self); }
 TimingRole *role() { return self->role(); }
 const char *sense() { return timingSenseString(self->sense()); }
 const TimingArcSeq &
@@ -160,6 +160,14 @@ proc trace_propagate_gated_clock_enable { name1 name2 op } {
     propagate_gated_clock_enable set_propagate_gated_clock_enable
 }
 
+trace variable ::sta_prune_exception_states "rw" \
+  sta::trace_prune_exception_states
+
+proc trace_prune_exception_states { name1 name2 op } {
+  trace_boolean_var $op ::sta_prune_exception_states \
+    prune_exception_states set_prune_exception_states
+}
+
 trace variable ::sta_pocv_enabled "rw" \
   sta::trace_pocv_enabled
 
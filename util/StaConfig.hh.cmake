@@ -7,3 +7,5 @@
 #define CUDD ${CUDD}
 
 #define SSTA ${SSTA}
+
+#define COMPACT_ARRIVALS ${COMPACT_ARRIVALS}
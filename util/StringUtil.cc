@@ -21,7 +21,6 @@
 #include <stdio.h>
 
 #include "Machine.hh"
-#include "Mutex.hh"
 
 namespace sta {
 
@@ -152,24 +151,38 @@ stringPrintTmp(const char *fmt,
 
 ////////////////////////////////////////////////////////////////
 
-static int tmp_string_count_ = 100;
-static char **tmp_strings_ = nullptr;
-static size_t *tmp_string_lengths_ = nullptr;
-static int tmp_string_next_;
-static std::mutex string_lock_;
+// Each thread has its own ring of temporary strings so names can be
+// formatted concurrently without one thread reusing a string another
+// thread has not finished with.
+static const int tmp_string_count_ = 100;
+static thread_local char **tmp_strings_ = nullptr;
+static thread_local size_t *tmp_string_lengths_ = nullptr;
+static thread_local int tmp_string_next_;
+
+class TmpStringsDeleter
+{
+public:
+  ~TmpStringsDeleter() { deleteTmpStrings(); }
+};
+
+static thread_local TmpStringsDeleter tmp_strings_deleter_;
 
 void
 initTmpStrings()
 {
-  size_t initial_length = 100;
+  if (tmp_strings_ == nullptr) {
+    size_t initial_length = 100;
 
-  tmp_strings_ = new char*[tmp_string_count_];
-  tmp_string_lengths_ = new size_t[tmp_string_count_];
-  for (int i = 0; i < tmp_string_count_; i++) {
-    tmp_strings_[i] = new char[initial_length];
-    tmp_string_lengths_[i] = initial_length;
+    tmp_strings_ = new char*[tmp_string_count_];
+    tmp_string_lengths_ = new size_t[tmp_string_count_];
+    for (int i = 0; i < tmp_string_count_; i++) {
+      tmp_strings_[i] = new char[initial_length];
+      tmp_string_lengths_[i] = initial_length;
+    }
+    tmp_string_next_ = 0;
+    // Reference the deleter so it is destroyed when this thread exits.
+    (void) &tmp_strings_deleter_;
   }
-  tmp_string_next_ = 0;
 }
 
 void
@@ -191,7 +204,7 @@ getTmpString(// Return values.
 	     char *&str,
 	     size_t &length)
 {
-  UniqueLock lock(string_lock_);
+  initTmpStrings();
   if (tmp_string_next_ == tmp_string_count_)
     tmp_string_next_ = 0;
   str = tmp_strings_[tmp_string_next_];
@@ -202,7 +215,7 @@ getTmpString(// Return values.
 char *
 makeTmpString(size_t length)
 {
-  UniqueLock lock(string_lock_);
+  initTmpStrings();
   if (tmp_string_next_ == tmp_string_count_)
     tmp_string_next_ = 0;
   char *tmp_str = tmp_strings_[tmp_string_next_];